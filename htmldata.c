@@ -1,13 +1,1570 @@
+static const unsigned char data_mirror_html[] = {
+	/* ./mirror.html */
+	0x2f, 0x6d, 0x69, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 
+	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 
+	0x69, 0x6c, 0x65, 0x20, 0x2d, 0x20, 0x45, 0x73, 0x70, 0x65, 
+	0x6c, 0x68, 0x6f, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 
+	0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 
+	0x61, 0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 
+	0x65, 0x72, 0x69, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x36, 
+	0x66, 0x37, 0x66, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
+	0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 
+	0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 
+	0x72, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 
+	0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x36, 0x30, 
+	0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 
+	0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x34, 0x30, 0x70, 0x78, 
+	0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 
+	0x35, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 
+	0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x30, 
+	0x20, 0x31, 0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 
+	0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 
+	0x30, 0x2e, 0x32, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 
+	0x75, 0x73, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 
+	0x35, 0x36, 0x62, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 
+	0x6e, 0x76, 0x61, 0x73, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
+	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 
+	0x30, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 
+	0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x23, 0x69, 0x6e, 0x66, 0x6f, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
+	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
+	0x20, 0x23, 0x36, 0x36, 0x36, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 
+	0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 
+	0x0d, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 
+	0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 
+	0x3e, 0x45, 0x73, 0x70, 0x65, 0x6c, 0x68, 0x6f, 0x20, 0x64, 
+	0x6f, 0x20, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 
+	0x65, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x63, 0x61, 0x6e, 
+	0x76, 0x61, 0x73, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6f, 0x6c, 
+	0x65, 0x64, 0x22, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 
+	0x22, 0x35, 0x31, 0x32, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 
+	0x68, 0x74, 0x3d, 0x22, 0x32, 0x35, 0x36, 0x22, 0x3e, 0x3c, 
+	0x2f, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x3e, 0x3c, 0x62, 
+	0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x63, 0x61, 0x6e, 0x76, 0x61, 0x73, 0x20, 
+	0x69, 0x64, 0x3d, 0x22, 0x6c, 0x65, 0x64, 0x73, 0x22, 0x20, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3d, 0x22, 0x32, 0x30, 0x30, 
+	0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3d, 0x22, 
+	0x32, 0x30, 0x30, 0x22, 0x3e, 0x3c, 0x2f, 0x63, 0x61, 0x6e, 
+	0x76, 0x61, 0x73, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x70, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x69, 0x6e, 0x66, 0x6f, 0x22, 0x3e, 0x43, 0x6f, 0x6e, 
+	0x65, 0x63, 0x74, 0x61, 0x6e, 0x64, 0x6f, 0x2e, 0x2e, 0x2e, 
+	0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4d, 0x65, 0x73, 0x6d, 0x6f, 
+	0x20, 0x6d, 0x61, 0x70, 0x65, 0x61, 0x6d, 0x65, 0x6e, 0x74, 
+	0x6f, 0x20, 0x64, 0x65, 0x20, 0x4c, 0x45, 0x44, 0x6d, 0x61, 
+	0x70, 0x5b, 0x35, 0x5d, 0x5b, 0x35, 0x5d, 0x20, 0x64, 0x6f, 
+	0x20, 0x66, 0x69, 0x72, 0x6d, 0x77, 0x61, 0x72, 0x65, 0x20, 
+	0x28, 0x6c, 0x69, 0x6e, 0x68, 0x61, 0x2c, 0x20, 0x63, 0x6f, 
+	0x6c, 0x75, 0x6e, 0x61, 0x29, 0x20, 0x2d, 0x3e, 0x20, 0x4c, 
+	0x45, 0x44, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x4c, 0x45, 
+	0x44, 0x4d, 0x41, 0x50, 0x20, 0x3d, 0x20, 0x5b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x5b, 0x32, 0x34, 0x2c, 0x20, 0x32, 0x33, 0x2c, 
+	0x20, 0x32, 0x32, 0x2c, 0x20, 0x32, 0x31, 0x2c, 0x20, 0x32, 
+	0x30, 0x5d, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x31, 0x35, 
+	0x2c, 0x20, 0x31, 0x36, 0x2c, 0x20, 0x31, 0x37, 0x2c, 0x20, 
+	0x31, 0x38, 0x2c, 0x20, 0x31, 0x39, 0x5d, 0x2c, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x5b, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x33, 0x2c, 
+	0x20, 0x31, 0x32, 0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x31, 
+	0x30, 0x5d, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x20, 0x35, 
+	0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 
+	0x20, 0x38, 0x2c, 0x20, 0x20, 0x39, 0x5d, 0x2c, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x5b, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x33, 0x2c, 
+	0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x31, 0x2c, 0x20, 0x20, 
+	0x30, 0x5d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x5d, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 
+	0x46, 0x4c, 0x41, 0x47, 0x5f, 0x4b, 0x45, 0x59, 0x20, 0x3d, 
+	0x20, 0x31, 0x2c, 0x20, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x55, 
+	0x4e, 0x43, 0x48, 0x41, 0x4e, 0x47, 0x45, 0x44, 0x20, 0x3d, 
+	0x20, 0x32, 0x2c, 0x20, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x50, 
+	0x41, 0x47, 0x45, 0x5f, 0x4d, 0x41, 0x4a, 0x4f, 0x52, 0x20, 
+	0x3d, 0x20, 0x34, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x74, 0x20, 
+	0x73, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x6f, 
+	0x6c, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 
+	0x2c, 0x20, 0x6c, 0x65, 0x64, 0x73, 0x20, 0x3d, 0x20, 0x6e, 
+	0x75, 0x6c, 0x6c, 0x2c, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 
+	0x20, 0x3d, 0x20, 0x30, 0x2c, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 
+	0x73, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 
+	0x20, 0x46, 0x4e, 0x56, 0x2d, 0x31, 0x61, 0x20, 0x64, 0x65, 
+	0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 
+	0x6f, 0x20, 0x6d, 0x65, 0x73, 0x6d, 0x6f, 0x20, 0x64, 0x65, 
+	0x20, 0x69, 0x6e, 0x63, 0x2f, 0x6d, 0x69, 0x72, 0x72, 0x6f, 
+	0x72, 0x2e, 0x63, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 
+	0x6e, 0x20, 0x66, 0x6e, 0x76, 0x31, 0x61, 0x28, 0x68, 0x2c, 
+	0x20, 0x64, 0x61, 0x74, 0x61, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 
+	0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 
+	0x3c, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2e, 0x6c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 
+	0x20, 0x3d, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x69, 0x6d, 
+	0x75, 0x6c, 0x28, 0x68, 0x20, 0x5e, 0x20, 0x64, 0x61, 0x74, 
+	0x61, 0x5b, 0x69, 0x5d, 0x2c, 0x20, 0x31, 0x36, 0x37, 0x37, 
+	0x37, 0x36, 0x31, 0x39, 0x29, 0x20, 0x3e, 0x3e, 0x3e, 0x20, 
+	0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x68, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x41, 0x70, 0x6c, 0x69, 
+	0x63, 0x61, 0x20, 0x75, 0x6d, 0x61, 0x20, 0x73, 0x65, 0xc3, 
+	0xa7, 0xc3, 0xa3, 0x6f, 0x20, 0x52, 0x4c, 0x45, 0x20, 0x28, 
+	0x58, 0x4f, 0x52, 0x20, 0x73, 0x6f, 0x62, 0x72, 0x65, 0x20, 
+	0x6f, 0x20, 0x71, 0x75, 0x61, 0x64, 0x72, 0x6f, 0x20, 0x61, 
+	0x74, 0x75, 0x61, 0x6c, 0x29, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x52, 
+	0x6c, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2c, 0x20, 0x70, 
+	0x6f, 0x73, 0x2c, 0x20, 0x6c, 0x65, 0x6e, 0x2c, 0x20, 0x74, 
+	0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x6c, 0x65, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 
+	0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x70, 0x6f, 
+	0x73, 0x20, 0x2b, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x70, 
+	0x6f, 0x73, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x29, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x20, 0x3d, 0x20, 0x64, 
+	0x61, 0x74, 0x61, 0x5b, 0x70, 0x6f, 0x73, 0x2b, 0x2b, 0x5d, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x66, 0x20, 0x28, 0x63, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 
+	0x30, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x76, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 
+	0x5b, 0x70, 0x6f, 0x73, 0x2b, 0x2b, 0x5d, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x6b, 
+	0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6b, 0x20, 0x3c, 0x3d, 
+	0x20, 0x28, 0x63, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x66, 
+	0x29, 0x3b, 0x20, 0x6b, 0x2b, 0x2b, 0x29, 0x20, 0x74, 0x61, 
+	0x72, 0x67, 0x65, 0x74, 0x5b, 0x69, 0x2b, 0x2b, 0x5d, 0x20, 
+	0x5e, 0x3d, 0x20, 0x76, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 
+	0x74, 0x20, 0x6b, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6b, 
+	0x20, 0x3c, 0x3d, 0x20, 0x63, 0x3b, 0x20, 0x6b, 0x2b, 0x2b, 
+	0x29, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5b, 0x69, 
+	0x2b, 0x2b, 0x5d, 0x20, 0x5e, 0x3d, 0x20, 0x64, 0x61, 0x74, 
+	0x61, 0x5b, 0x70, 0x6f, 0x73, 0x2b, 0x2b, 0x5d, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 
+	0x75, 0x72, 0x6e, 0x20, 0x65, 0x6e, 0x64, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x28, 0x62, 0x75, 0x66, 
+	0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 
+	0x73, 0x74, 0x20, 0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 
+	0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 
+	0x79, 0x28, 0x62, 0x75, 0x66, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x2e, 0x6c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x20, 0x3c, 0x20, 0x31, 0x38, 0x20, 0x7c, 
+	0x7c, 0x20, 0x64, 0x5b, 0x30, 0x5d, 0x20, 0x21, 0x3d, 0x3d, 
+	0x20, 0x30, 0x78, 0x34, 0x32, 0x20, 0x7c, 0x7c, 0x20, 0x64, 
+	0x5b, 0x31, 0x5d, 0x20, 0x21, 0x3d, 0x3d, 0x20, 0x30, 0x78, 
+	0x34, 0x64, 0x20, 0x7c, 0x7c, 0x20, 0x64, 0x5b, 0x32, 0x5d, 
+	0x20, 0x21, 0x3d, 0x3d, 0x20, 0x32, 0x29, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 
+	0x76, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x44, 0x61, 
+	0x74, 0x61, 0x56, 0x69, 0x65, 0x77, 0x28, 0x62, 0x75, 0x66, 
+	0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x66, 0x20, 0x3d, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 
+	0x3a, 0x20, 0x64, 0x5b, 0x33, 0x5d, 0x2c, 0x20, 0x73, 0x65, 
+	0x71, 0x3a, 0x20, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 
+	0x6e, 0x74, 0x33, 0x32, 0x28, 0x34, 0x2c, 0x20, 0x74, 0x72, 
+	0x75, 0x65, 0x29, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x64, 
+	0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3a, 0x20, 0x64, 0x5b, 0x39, 0x5d, 0x2c, 0x20, 0x6e, 
+	0x4c, 0x65, 0x64, 0x73, 0x3a, 0x20, 0x64, 0x5b, 0x31, 0x30, 
+	0x5d, 0x2c, 0x20, 0x6f, 0x6c, 0x65, 0x64, 0x4c, 0x65, 0x6e, 
+	0x3a, 0x20, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6e, 
+	0x74, 0x31, 0x36, 0x28, 0x31, 0x32, 0x2c, 0x20, 0x74, 0x72, 
+	0x75, 0x65, 0x29, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x72, 0x63, 0x3a, 0x20, 0x76, 0x2e, 0x67, 
+	0x65, 0x74, 0x55, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x28, 0x31, 
+	0x34, 0x2c, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x21, 0x28, 0x66, 0x2e, 0x66, 0x6c, 0x61, 0x67, 
+	0x73, 0x20, 0x26, 0x20, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x55, 
+	0x4e, 0x43, 0x48, 0x41, 0x4e, 0x47, 0x45, 0x44, 0x29, 0x29, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x69, 0x66, 0x20, 0x28, 0x28, 0x66, 0x2e, 0x66, 0x6c, 0x61, 
+	0x67, 0x73, 0x20, 0x26, 0x20, 0x46, 0x4c, 0x41, 0x47, 0x5f, 
+	0x4b, 0x45, 0x59, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x21, 0x6f, 
+	0x6c, 0x65, 0x64, 0x20, 0x7c, 0x7c, 0x20, 0x6f, 0x6c, 0x65, 
+	0x64, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x21, 
+	0x3d, 0x3d, 0x20, 0x66, 0x2e, 0x6f, 0x6c, 0x65, 0x64, 0x4c, 
+	0x65, 0x6e, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x6c, 0x65, 
+	0x64, 0x20, 0x3d, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x55, 0x69, 
+	0x6e, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x66, 
+	0x2e, 0x6f, 0x6c, 0x65, 0x64, 0x4c, 0x65, 0x6e, 0x29, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x6c, 0x65, 0x64, 0x73, 0x20, 0x3d, 0x20, 0x6e, 
+	0x65, 0x77, 0x20, 0x55, 0x69, 0x6e, 0x74, 0x38, 0x41, 0x72, 
+	0x72, 0x61, 0x79, 0x28, 0x66, 0x2e, 0x6e, 0x4c, 0x65, 0x64, 
+	0x73, 0x20, 0x2a, 0x20, 0x33, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x74, 0x20, 0x70, 0x6f, 
+	0x73, 0x20, 0x3d, 0x20, 0x31, 0x38, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 
+	0x20, 0x6e, 0x31, 0x20, 0x3d, 0x20, 0x76, 0x2e, 0x67, 0x65, 
+	0x74, 0x55, 0x69, 0x6e, 0x74, 0x31, 0x36, 0x28, 0x70, 0x6f, 
+	0x73, 0x2c, 0x20, 0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6f, 0x73, 
+	0x20, 0x3d, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x52, 0x6c, 
+	0x65, 0x28, 0x64, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x20, 0x2b, 
+	0x20, 0x32, 0x2c, 0x20, 0x6e, 0x31, 0x2c, 0x20, 0x6f, 0x6c, 
+	0x65, 0x64, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x32, 
+	0x20, 0x3d, 0x20, 0x76, 0x2e, 0x67, 0x65, 0x74, 0x55, 0x69, 
+	0x6e, 0x74, 0x31, 0x36, 0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 
+	0x74, 0x72, 0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x52, 
+	0x6c, 0x65, 0x28, 0x64, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x20, 
+	0x2b, 0x20, 0x32, 0x2c, 0x20, 0x6e, 0x32, 0x2c, 0x20, 0x6c, 
+	0x65, 0x64, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x51, 0x75, 0x61, 
+	0x64, 0x72, 0x6f, 0x20, 0x64, 0x69, 0x66, 0x65, 0x72, 0x65, 
+	0x6e, 0x74, 0x65, 0x20, 0x64, 0x6f, 0x20, 0x64, 0x61, 0x20, 
+	0x70, 0x6c, 0x61, 0x63, 0x61, 0x20, 0x28, 0x72, 0x65, 0x73, 
+	0x70, 0x6f, 0x73, 0x74, 0x61, 0x20, 0x63, 0x6f, 0x72, 0x72, 
+	0x6f, 0x6d, 0x70, 0x69, 0x64, 0x61, 0x20, 0x6f, 0x75, 0x20, 
+	0x62, 0x61, 0x73, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 
+	0x20, 0x65, 0x72, 0x72, 0x61, 0x64, 0x61, 0x29, 0x3a, 0x20, 
+	0x64, 0x65, 0x73, 0x63, 0x61, 0x72, 0x74, 0x61, 0x20, 0x65, 
+	0x20, 0x70, 0x65, 0x64, 0x65, 0x20, 0x75, 0x6d, 0x20, 0x71, 
+	0x75, 0x61, 0x64, 0x72, 0x6f, 0x2d, 0x63, 0x68, 0x61, 0x76, 
+	0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 
+	0x6f, 0x6c, 0x65, 0x64, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x6e, 
+	0x76, 0x31, 0x61, 0x28, 0x66, 0x6e, 0x76, 0x31, 0x61, 0x28, 
+	0x32, 0x31, 0x36, 0x36, 0x31, 0x33, 0x36, 0x32, 0x36, 0x31, 
+	0x2c, 0x20, 0x6f, 0x6c, 0x65, 0x64, 0x29, 0x2c, 0x20, 0x6c, 
+	0x65, 0x64, 0x73, 0x29, 0x20, 0x21, 0x3d, 0x3d, 0x20, 0x66, 
+	0x2e, 0x63, 0x72, 0x63, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x6c, 0x65, 0x64, 0x20, 
+	0x3d, 0x20, 0x6c, 0x65, 0x64, 0x73, 0x20, 0x3d, 0x20, 0x6e, 
+	0x75, 0x6c, 0x6c, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 
+	0x75, 0x6c, 0x6c, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 
+	0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 
+	0x69, 0x6f, 0x6e, 0x20, 0x64, 0x72, 0x61, 0x77, 0x4f, 0x6c, 
+	0x65, 0x64, 0x28, 0x66, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x63, 0x74, 0x78, 
+	0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 
+	0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 
+	0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6f, 0x6c, 
+	0x65, 0x64, 0x27, 0x29, 0x2e, 0x67, 0x65, 0x74, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x78, 0x74, 0x28, 0x27, 0x32, 0x64, 0x27, 
+	0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x34, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 
+	0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x23, 
+	0x30, 0x30, 0x30, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x52, 0x65, 0x63, 
+	0x74, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x66, 0x2e, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2a, 0x20, 0x73, 0x2c, 
+	0x20, 0x66, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 
+	0x2a, 0x20, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x53, 0x74, 0x79, 
+	0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x23, 0x37, 0x66, 0x64, 
+	0x37, 0x66, 0x66, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 
+	0x20, 0x3d, 0x20, 0x66, 0x2e, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x20, 0x3e, 0x3e, 0x20, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 
+	0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 
+	0x20, 0x6f, 0x6c, 0x65, 0x64, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+	0x6e, 0x73, 0x74, 0x20, 0x62, 0x20, 0x3d, 0x20, 0x6f, 0x6c, 
+	0x65, 0x64, 0x5b, 0x69, 0x5d, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 
+	0x29, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 
+	0x2f, 0x20, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 
+	0x3a, 0x20, 0xc3, 0xad, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x20, 
+	0x3d, 0x20, 0x78, 0x20, 0x2a, 0x20, 0x70, 0xc3, 0xa1, 0x67, 
+	0x69, 0x6e, 0x61, 0x73, 0x20, 0x2b, 0x20, 0x70, 0xc3, 0xa1, 
+	0x67, 0x69, 0x6e, 0x61, 0x3b, 0x20, 0x65, 0x6d, 0x20, 0x70, 
+	0xc3, 0xa1, 0x67, 0x69, 0x6e, 0x61, 0x73, 0x3a, 0x20, 0x70, 
+	0xc3, 0xa1, 0x67, 0x69, 0x6e, 0x61, 0x20, 0x2a, 0x20, 0x6c, 
+	0x61, 0x72, 0x67, 0x75, 0x72, 0x61, 0x20, 0x2b, 0x20, 0x78, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+	0x6e, 0x73, 0x74, 0x20, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x66, 
+	0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x46, 
+	0x4c, 0x41, 0x47, 0x5f, 0x50, 0x41, 0x47, 0x45, 0x5f, 0x4d, 
+	0x41, 0x4a, 0x4f, 0x52, 0x29, 0x20, 0x3f, 0x20, 0x69, 0x20, 
+	0x25, 0x20, 0x66, 0x2e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 
+	0x3a, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x66, 0x6c, 0x6f, 
+	0x6f, 0x72, 0x28, 0x69, 0x20, 0x2f, 0x20, 0x70, 0x61, 0x67, 
+	0x65, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x70, 0x61, 
+	0x67, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x2e, 0x66, 0x6c, 
+	0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x46, 0x4c, 0x41, 0x47, 
+	0x5f, 0x50, 0x41, 0x47, 0x45, 0x5f, 0x4d, 0x41, 0x4a, 0x4f, 
+	0x52, 0x29, 0x20, 0x3f, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 
+	0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x28, 0x69, 0x20, 0x2f, 0x20, 
+	0x66, 0x2e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x3a, 
+	0x20, 0x69, 0x20, 0x25, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+	0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x62, 0x69, 
+	0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x62, 0x69, 0x74, 
+	0x20, 0x3c, 0x20, 0x38, 0x3b, 0x20, 0x62, 0x69, 0x74, 0x2b, 
+	0x2b, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+	0x62, 0x20, 0x26, 0x20, 0x28, 0x31, 0x20, 0x3c, 0x3c, 0x20, 
+	0x62, 0x69, 0x74, 0x29, 0x29, 0x20, 0x63, 0x74, 0x78, 0x2e, 
+	0x66, 0x69, 0x6c, 0x6c, 0x52, 0x65, 0x63, 0x74, 0x28, 0x78, 
+	0x20, 0x2a, 0x20, 0x73, 0x2c, 0x20, 0x28, 0x70, 0x61, 0x67, 
+	0x65, 0x20, 0x2a, 0x20, 0x38, 0x20, 0x2b, 0x20, 0x62, 0x69, 
+	0x74, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x2c, 0x20, 0x73, 0x2c, 
+	0x20, 0x73, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x64, 0x72, 0x61, 0x77, 0x4c, 0x65, 0x64, 0x73, 0x28, 0x29, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x63, 0x74, 0x78, 0x20, 0x3d, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x27, 0x6c, 0x65, 0x64, 0x73, 0x27, 0x29, 0x2e, 
+	0x67, 0x65, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 
+	0x28, 0x27, 0x32, 0x64, 0x27, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x53, 
+	0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x23, 0x32, 
+	0x32, 0x32, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 
+	0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x52, 0x65, 0x63, 0x74, 
+	0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x32, 0x30, 0x30, 
+	0x2c, 0x20, 0x32, 0x30, 0x30, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 
+	0x72, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x72, 0x20, 0x3c, 
+	0x20, 0x35, 0x3b, 0x20, 0x72, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 
+	0x72, 0x20, 0x28, 0x6c, 0x65, 0x74, 0x20, 0x63, 0x20, 0x3d, 
+	0x20, 0x30, 0x3b, 0x20, 0x63, 0x20, 0x3c, 0x20, 0x35, 0x3b, 
+	0x20, 0x63, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x4c, 
+	0x45, 0x44, 0x4d, 0x41, 0x50, 0x5b, 0x72, 0x5d, 0x5b, 0x63, 
+	0x5d, 0x20, 0x2a, 0x20, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x69, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x3e, 0x3d, 
+	0x20, 0x6c, 0x65, 0x64, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 
+	0x74, 0x68, 0x29, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 
+	0x75, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x42, 0x79, 
+	0x74, 0x65, 0x73, 0x20, 0x6e, 0x61, 0x20, 0x6f, 0x72, 0x64, 
+	0x65, 0x6d, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x61, 0x64, 0x61, 
+	0x20, 0x61, 0x6f, 0x20, 0x57, 0x53, 0x32, 0x38, 0x31, 0x32, 
+	0x20, 0x28, 0x47, 0x2c, 0x20, 0x52, 0x2c, 0x20, 0x42, 0x29, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x66, 0x69, 0x6c, 0x6c, 
+	0x53, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x72, 
+	0x67, 0x62, 0x28, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x65, 0x64, 
+	0x73, 0x5b, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x2b, 
+	0x20, 0x27, 0x2c, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x65, 0x64, 
+	0x73, 0x5b, 0x69, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x2c, 0x27, 
+	0x20, 0x2b, 0x20, 0x6c, 0x65, 0x64, 0x73, 0x5b, 0x69, 0x20, 
+	0x2b, 0x20, 0x32, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x29, 0x27, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 0x2e, 0x62, 0x65, 0x67, 
+	0x69, 0x6e, 0x50, 0x61, 0x74, 0x68, 0x28, 0x29, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x74, 0x78, 0x2e, 0x61, 0x72, 0x63, 0x28, 0x63, 
+	0x20, 0x2a, 0x20, 0x34, 0x30, 0x20, 0x2b, 0x20, 0x32, 0x30, 
+	0x2c, 0x20, 0x72, 0x20, 0x2a, 0x20, 0x34, 0x30, 0x20, 0x2b, 
+	0x20, 0x32, 0x30, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x30, 
+	0x2c, 0x20, 0x32, 0x20, 0x2a, 0x20, 0x4d, 0x61, 0x74, 0x68, 
+	0x2e, 0x50, 0x49, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x74, 0x78, 
+	0x2e, 0x66, 0x69, 0x6c, 0x6c, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 
+	0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 
+	0x70, 0x6f, 0x6c, 0x6c, 0x28, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x74, 0x72, 0x79, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 
+	0x20, 0x72, 0x65, 0x73, 0x70, 0x20, 0x3d, 0x20, 0x61, 0x77, 
+	0x61, 0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 
+	0x27, 0x2f, 0x6d, 0x69, 0x72, 0x72, 0x6f, 0x72, 0x2e, 0x63, 
+	0x67, 0x69, 0x3f, 0x73, 0x69, 0x6e, 0x63, 0x65, 0x3d, 0x27, 
+	0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x2c, 0x20, 0x7b, 0x20, 
+	0x63, 0x61, 0x63, 0x68, 0x65, 0x3a, 0x20, 0x27, 0x6e, 0x6f, 
+	0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x27, 0x20, 0x7d, 0x29, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x75, 0x66, 0x20, 0x3d, 
+	0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 
+	0x70, 0x2e, 0x61, 0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 
+	0x66, 0x65, 0x72, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 
+	0x66, 0x20, 0x3d, 0x20, 0x64, 0x65, 0x63, 0x6f, 0x64, 0x65, 
+	0x28, 0x62, 0x75, 0x66, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x73, 0x2b, 
+	0x2b, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x62, 
+	0x75, 0x66, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x4c, 0x65, 0x6e, 
+	0x67, 0x74, 0x68, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x66, 0x29, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x73, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x30, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 
+	0x21, 0x28, 0x66, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 
+	0x26, 0x20, 0x46, 0x4c, 0x41, 0x47, 0x5f, 0x55, 0x4e, 0x43, 
+	0x48, 0x41, 0x4e, 0x47, 0x45, 0x44, 0x29, 0x29, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x73, 0x65, 0x71, 0x20, 0x3d, 0x20, 0x66, 0x2e, 
+	0x73, 0x65, 0x71, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x72, 0x61, 0x77, 
+	0x4f, 0x6c, 0x65, 0x64, 0x28, 0x66, 0x29, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x64, 0x72, 0x61, 0x77, 0x4c, 0x65, 0x64, 0x73, 0x28, 0x29, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x27, 0x69, 0x6e, 0x66, 0x6f, 0x27, 0x29, 0x2e, 
+	0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x20, 0x3d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x51, 0x75, 0x61, 0x64, 
+	0x72, 0x6f, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 
+	0x20, 0x2b, 0x20, 0x27, 0x20, 0x2d, 0x20, 0x27, 0x20, 0x2b, 
+	0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x73, 0x20, 0x2b, 0x20, 0x27, 
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x75, 0x6c, 0x74, 0x61, 0x73, 
+	0x2c, 0x20, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x20, 0x64, 0x65, 
+	0x20, 0x27, 0x20, 0x2b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x61, 0x74, 0x68, 
+	0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x62, 0x79, 0x74, 
+	0x65, 0x73, 0x20, 0x2f, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x73, 
+	0x29, 0x20, 0x2b, 0x20, 0x27, 0x20, 0x62, 0x79, 0x74, 0x65, 
+	0x73, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 
+	0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x27, 0x69, 0x6e, 0x66, 0x6f, 0x27, 0x29, 0x2e, 
+	0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 
+	0x74, 0x20, 0x3d, 0x20, 0x27, 0x53, 0x65, 0x6d, 0x20, 0x63, 
+	0x6f, 0x6e, 0x65, 0x78, 0x61, 0x6f, 0x27, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 
+	0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x70, 0x6f, 
+	0x6c, 0x6c, 0x2c, 0x20, 0x32, 0x30, 0x30, 0x29, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x70, 0x6f, 0x6c, 0x6c, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 
+	0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+	0x0d, 0x0a, };
+
+static const unsigned char data_quiz_closed_txt[] = {
+	/* ./quiz_closed.txt */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x5f, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x2e, 0x74, 0x78, 0x74, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	
+	0x66, 0x65, 0x63, 0x68, 0x61, 0x64, 0x6f, };
 
 static const unsigned char data_index_shtml[] = {
-    /* .\index.shtml */
-    0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0x00,
-    0x0a, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x50, 0x69, 0x63, 0x6f, 0x57, 0x20, 0x57, 0x65, 0x62, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x30, 0x66, 0x38, 0x66, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x35, 0x30, 0x70, 0x78, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x30, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x32, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x35, 0x35, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x32, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5d, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x35, 0x70, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x30, 0x2e, 0x33, 0x73, 0x20, 0x65, 0x61, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x35, 0x36, 0x61, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 0x3e, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x45, 0x6e, 0x76, 0x69, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x4c, 0x65, 0x74, 0x72, 0x61, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x6f, 0x20, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x6e, 0x64, 0x2e, 0x63, 0x67, 0x69, 0x22, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x22, 0x3e, 0x44, 0x69, 0x67, 0x69, 0x74, 0x65, 0x20, 0x75, 0x6d, 0x61, 0x20, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x22, 0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x45, 0x6e, 0x76, 0x69, 0x61, 0x72, 0x20, 0x4c, 0x65, 0x74, 0x72, 0x61, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a
-};
+	/* ./index.shtml */
+	0x2f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2e, 0x73, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 
+	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 
+	0x69, 0x6c, 0x65, 0x20, 0x57, 0x65, 0x62, 0x73, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x74, 
+	0x79, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x73, 0x74, 
+	0x69, 0x6c, 0x6f, 0x20, 0x67, 0x65, 0x72, 0x61, 0x6c, 0x20, 
+	0x64, 0x61, 0x20, 0x70, 0xc3, 0xa1, 0x67, 0x69, 0x6e, 0x61, 
+	0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x7b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 
+	0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 0x69, 0x61, 
+	0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 0x73, 0x65, 
+	0x72, 0x69, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 0x36, 0x66, 
+	0x37, 0x66, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 0x33, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
+	0x3a, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
+	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x30, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 
+	0x69, 0x67, 0x6e, 0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 
+	0x72, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x43, 0x6f, 
+	0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x20, 0x70, 0x72, 
+	0x69, 0x6e, 0x63, 0x69, 0x70, 0x61, 0x6c, 0x20, 0x2a, 0x2f, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x78, 0x2d, 
+	0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x36, 0x30, 0x30, 
+	0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 
+	0x67, 0x69, 0x6e, 0x3a, 0x20, 0x36, 0x30, 0x70, 0x78, 0x20, 
+	0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+	0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x32, 0x35, 
+	0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 0x66, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 
+	0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x30, 0x20, 
+	0x31, 0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 
+	0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 
+	0x2e, 0x32, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 
+	0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 
+	0x73, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2f, 0x2a, 0x20, 0x45, 0x73, 0x74, 0x69, 0x6c, 0x6f, 
+	0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x6f, 0x73, 0x20, 0x74, 
+	0xc3, 0xad, 0x74, 0x75, 0x6c, 0x6f, 0x73, 0x20, 0x2a, 0x2f, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x68, 0x31, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x35, 0x36, 
+	0x62, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 
+	0x67, 0x69, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 
+	0x3a, 0x20, 0x31, 0x35, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x68, 0x32, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x34, 0x34, 0x34, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+	0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x32, 
+	0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 
+	0x30, 0x30, 0x35, 0x36, 0x62, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x62, 
+	0x6f, 0x74, 0x74, 0x6f, 0x6d, 0x3a, 0x20, 0x38, 0x70, 0x78, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 
+	0x6e, 0x2d, 0x74, 0x6f, 0x70, 0x3a, 0x20, 0x32, 0x35, 0x70, 
+	0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x73, 
+	0x74, 0x69, 0x6c, 0x6f, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 
+	0x6f, 0x73, 0x20, 0x70, 0x61, 0x72, 0xc3, 0xa1, 0x67, 0x72, 
+	0x61, 0x66, 0x6f, 0x73, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 
+	0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
+	0x3a, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x2f, 0x2a, 0x20, 0x43, 0x61, 0x6d, 0x70, 0x6f, 
+	0x20, 0x64, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x61, 0x64, 
+	0x61, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5b, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x22, 0x5d, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 
+	0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 0x32, 0x70, 
+	0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 
+	0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 
+	0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 
+	0x68, 0x3a, 0x20, 0x38, 0x30, 0x25, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6d, 0x61, 0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3a, 0x20, 0x33, 0x35, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 
+	0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x31, 
+	0x70, 0x78, 0x20, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 
+	0x30, 0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 
+	0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 0x73, 0x68, 
+	0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 0x30, 0x20, 
+	0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 0x61, 0x28, 0x30, 
+	0x2c, 0x20, 0x31, 0x32, 0x30, 0x2c, 0x20, 0x32, 0x31, 0x32, 
+	0x2c, 0x20, 0x30, 0x2e, 0x33, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x2f, 0x2a, 0x20, 0x42, 0x6f, 0x74, 0xc3, 0xa3, 0x6f, 0x20, 
+	0x64, 0x65, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x6f, 0x20, 0x2a, 
+	0x2f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x7b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 
+	0x79, 0x3a, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 
+	0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x31, 
+	0x32, 0x70, 0x78, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 
+	0x7a, 0x65, 0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
+	0x77, 0x68, 0x69, 0x74, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
+	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 
+	0x30, 0x37, 0x38, 0x64, 0x34, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 
+	0x6e, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 
+	0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x74, 0x65, 0x78, 0x74, 0x2d, 0x64, 0x65, 0x63, 0x6f, 0x72, 
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 
+	0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x73, 
+	0x6f, 0x72, 0x3a, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 
+	0x72, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 
+	0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x62, 0x61, 
+	0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 
+	0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x30, 0x2e, 0x33, 0x73, 0x20, 
+	0x65, 0x61, 0x73, 0x65, 0x2c, 0x20, 0x74, 0x72, 0x61, 0x6e, 
+	0x73, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x30, 0x2e, 0x32, 0x73, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x2e, 0x62, 0x75, 0x74, 0x74, 0x6f, 
+	0x6e, 0x3a, 0x68, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x7b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 
+	0x20, 0x23, 0x30, 0x30, 0x34, 0x63, 0x39, 0x39, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 
+	0x72, 0x6d, 0x3a, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x28, 
+	0x31, 0x2e, 0x30, 0x35, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 
+	0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3a, 0x61, 0x63, 0x74, 
+	0x69, 0x76, 0x65, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+	0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x20, 
+	0x73, 0x63, 0x61, 0x6c, 0x65, 0x28, 0x30, 0x2e, 0x39, 0x35, 
+	0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x52, 0x6f, 
+	0x64, 0x61, 0x70, 0xc3, 0xa9, 0x20, 0x2a, 0x2f, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 
+	0x6f, 0x74, 0x65, 0x72, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x70, 
+	0x3a, 0x20, 0x33, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 
+	0x3a, 0x20, 0x31, 0x34, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x36, 
+	0x36, 0x36, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 
+	0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0d, 0x0a, 0x3c, 
+	0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 
+	0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+	0x65, 0x72, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x31, 0x3e, 0x42, 0x69, 
+	0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x68, 
+	0x31, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x68, 0x32, 0x3e, 0x45, 0x6e, 
+	0x76, 0x69, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x4c, 0x65, 0x74, 
+	0x72, 0x61, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x6f, 0x20, 
+	0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x3c, 
+	0x2f, 0x68, 0x32, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 
+	0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 
+	0x65, 0x6e, 0x64, 0x2e, 0x63, 0x67, 0x69, 0x22, 0x20, 0x6d, 
+	0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 
+	0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 
+	0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x6c, 0x65, 
+	0x74, 0x72, 0x61, 0x22, 0x3e, 0x44, 0x69, 0x67, 0x69, 0x74, 
+	0x65, 0x20, 0x75, 0x6d, 0x61, 0x20, 0x6c, 0x65, 0x74, 0x72, 
+	0x61, 0x3a, 0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 
+	0x3c, 0x62, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 
+	0x22, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x22, 0x20, 0x6e, 0x61, 
+	0x6d, 0x65, 0x3d, 0x22, 0x6c, 0x65, 0x74, 0x72, 0x61, 0x22, 
+	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x3d, 0x22, 0x31, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 
+	0x72, 0x65, 0x64, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 
+	0x69, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x45, 
+	0x6e, 0x76, 0x69, 0x61, 0x72, 0x20, 0x4c, 0x65, 0x74, 0x72, 
+	0x61, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0d, 0x0a, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x68, 0x32, 0x3e, 0x4c, 0x65, 0x69, 0x74, 0x75, 0x72, 0x61, 
+	0x20, 0x64, 0x65, 0x20, 0x50, 0x61, 0x6c, 0x61, 0x76, 0x72, 
+	0x61, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 
+	0x6d, 0x20, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 
+	0x2f, 0x73, 0x65, 0x6e, 0x64, 0x2e, 0x63, 0x67, 0x69, 0x22, 
+	0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 
+	0x65, 0x74, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 
+	0x70, 0x61, 0x6c, 0x61, 0x76, 0x72, 0x61, 0x22, 0x3e, 0x44, 
+	0x69, 0x67, 0x69, 0x74, 0x65, 0x20, 0x75, 0x6d, 0x61, 0x20, 
+	0x70, 0x61, 0x6c, 0x61, 0x76, 0x72, 0x61, 0x3a, 0x3c, 0x2f, 
+	0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 
+	0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 
+	0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x61, 0x6c, 
+	0x61, 0x76, 0x72, 0x61, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 
+	0x3d, 0x22, 0x70, 0x61, 0x6c, 0x61, 0x76, 0x72, 0x61, 0x22, 
+	0x20, 0x6d, 0x61, 0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 
+	0x3d, 0x22, 0x33, 0x32, 0x22, 0x20, 0x72, 0x65, 0x71, 0x75, 
+	0x69, 0x72, 0x65, 0x64, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 
+	0x66, 0x6f, 0x72, 0x3d, 0x22, 0x76, 0x65, 0x6c, 0x22, 0x3e, 
+	0x56, 0x65, 0x6c, 0x6f, 0x63, 0x69, 0x64, 0x61, 0x64, 0x65, 
+	0x20, 0x28, 0x6d, 0x73, 0x20, 0x70, 0x6f, 0x72, 0x20, 0x63, 
+	0x6f, 0x6c, 0x75, 0x6e, 0x61, 0x29, 0x3a, 0x3c, 0x2f, 0x6c, 
+	0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 
+	0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x76, 0x65, 0x6c, 0x22, 
+	0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x65, 0x6c, 
+	0x22, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3d, 0x22, 0x31, 
+	0x35, 0x30, 0x22, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 
+	0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 
+	0x69, 0x74, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+	0x22, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x52, 
+	0x6f, 0x6c, 0x61, 0x72, 0x20, 0x50, 0x61, 0x6c, 0x61, 0x76, 
+	0x72, 0x61, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 0x6d, 0x3e, 0x0d, 0x0a, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x68, 0x32, 0x3e, 0x41, 0x63, 0x6f, 0x6d, 0x70, 0x61, 
+	0x6e, 0x68, 0x61, 0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x3c, 0x2f, 
+	0x68, 0x32, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x70, 0x3e, 0x3c, 0x61, 0x20, 0x68, 
+	0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d, 0x69, 0x72, 0x72, 
+	0x6f, 0x72, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x20, 0x63, 
+	0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 0x74, 
+	0x6f, 0x6e, 0x22, 0x3e, 0x45, 0x73, 0x70, 0x65, 0x6c, 0x68, 
+	0x6f, 0x20, 0x64, 0x61, 0x20, 0x54, 0x65, 0x6c, 0x61, 0x20, 
+	0x65, 0x20, 0x64, 0x6f, 0x73, 0x20, 0x4c, 0x45, 0x44, 0x73, 
+	0x3c, 0x2f, 0x61, 0x3e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x68, 0x32, 0x3e, 0x51, 0x75, 0x69, 0x7a, 0x20, 0x64, 
+	0x61, 0x20, 0x54, 0x75, 0x72, 0x6d, 0x61, 0x3c, 0x2f, 0x68, 
+	0x32, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x61, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x2f, 0x73, 0x65, 0x6e, 
+	0x64, 0x2e, 0x63, 0x67, 0x69, 0x22, 0x20, 0x6d, 0x65, 0x74, 
+	0x68, 0x6f, 0x64, 0x3d, 0x22, 0x67, 0x65, 0x74, 0x22, 0x3e, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x6c, 0x61, 0x62, 0x65, 0x6c, 
+	0x20, 0x66, 0x6f, 0x72, 0x3d, 0x22, 0x71, 0x75, 0x69, 0x7a, 
+	0x22, 0x3e, 0x4c, 0x65, 0x74, 0x72, 0x61, 0x20, 0x64, 0x61, 
+	0x20, 0x72, 0x6f, 0x64, 0x61, 0x64, 0x61, 0x20, 0x28, 0x30, 
+	0x20, 0x65, 0x6e, 0x63, 0x65, 0x72, 0x72, 0x61, 0x29, 0x3a, 
+	0x3c, 0x2f, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x3e, 0x3c, 0x62, 
+	0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x69, 0x6e, 0x70, 
+	0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3d, 0x22, 0x74, 
+	0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x71, 
+	0x75, 0x69, 0x7a, 0x22, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 
+	0x22, 0x71, 0x75, 0x69, 0x7a, 0x22, 0x20, 0x6d, 0x61, 0x78, 
+	0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 0x22, 
+	0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3e, 
+	0x3c, 0x62, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x62, 
+	0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x73, 0x75, 0x62, 0x6d, 0x69, 0x74, 0x22, 0x20, 
+	0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x62, 0x75, 0x74, 
+	0x74, 0x6f, 0x6e, 0x22, 0x3e, 0x41, 0x62, 0x72, 0x69, 0x72, 
+	0x2f, 0x45, 0x6e, 0x63, 0x65, 0x72, 0x72, 0x61, 0x72, 0x20, 
+	0x52, 0x6f, 0x64, 0x61, 0x64, 0x61, 0x3c, 0x2f, 0x62, 0x75, 
+	0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x72, 
+	0x6d, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x70, 0x3e, 0x4f, 0x73, 0x20, 0x61, 0x6c, 
+	0x75, 0x6e, 0x6f, 0x73, 0x20, 0x72, 0x65, 0x73, 0x70, 0x6f, 
+	0x6e, 0x64, 0x65, 0x6d, 0x20, 0x65, 0x6d, 0x20, 0x3c, 0x61, 
+	0x20, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x71, 0x75, 
+	0x69, 0x7a, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x22, 0x3e, 0x2f, 
+	0x71, 0x75, 0x69, 0x7a, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x3c, 
+	0x2f, 0x61, 0x3e, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 
+	0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x66, 
+	0x6f, 0x6f, 0x74, 0x65, 0x72, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x63, 0x6f, 0x70, 
+	0x79, 0x3b, 0x20, 0x32, 0x30, 0x32, 0x35, 0x20, 0x42, 0x69, 
+	0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x20, 0x50, 0x72, 
+	0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x20, 0x54, 0x6f, 0x64, 
+	0x6f, 0x73, 0x20, 0x6f, 0x73, 0x20, 0x64, 0x69, 0x72, 0x65, 
+	0x69, 0x74, 0x6f, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 
+	0x76, 0x61, 0x64, 0x6f, 0x73, 0x2e, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x2f, 0x66, 0x6f, 0x6f, 0x74, 0x65, 0x72, 
+	0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
+	0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 
+	0x0a, };
+
+static const unsigned char data_quiz_err_txt[] = {
+	/* ./quiz_err.txt */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x5f, 0x65, 0x72, 0x72, 0x2e, 0x74, 0x78, 0x74, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	
+	0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x61, };
+
+static const unsigned char data_quiz_html[] = {
+	/* ./quiz.html */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 
+	0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x74, 
+	0x6d, 0x6c, 0x3e, 0x0d, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 
+	0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x74, 0x69, 
+	0x74, 0x6c, 0x65, 0x3e, 0x42, 0x69, 0x74, 0x42, 0x72, 0x61, 
+	0x69, 0x6c, 0x65, 0x20, 0x2d, 0x20, 0x51, 0x75, 0x69, 0x7a, 
+	0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 
+	0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 
+	0x70, 0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 
+	0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+	0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 
+	0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 
+	0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 
+	0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 
+	0x74, 0x79, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 
+	0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x20, 0x41, 0x72, 
+	0x69, 0x61, 0x6c, 0x2c, 0x20, 0x73, 0x61, 0x6e, 0x73, 0x2d, 
+	0x73, 0x65, 0x72, 0x69, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 
+	0x2d, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x65, 
+	0x36, 0x66, 0x37, 0x66, 0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x33, 0x33, 
+	0x33, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 
+	0x69, 0x6e, 0x3a, 0x20, 0x30, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 
+	0x3a, 0x20, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x2e, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
+	0x65, 0x72, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 
+	0x78, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x34, 
+	0x32, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 
+	0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x20, 0x32, 0x30, 0x70, 
+	0x78, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 
+	0x32, 0x30, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x66, 0x66, 
+	0x66, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x78, 0x2d, 
+	0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x3a, 0x20, 0x30, 0x20, 
+	0x30, 0x20, 0x31, 0x35, 0x70, 0x78, 0x20, 0x72, 0x67, 0x62, 
+	0x61, 0x28, 0x30, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x30, 0x2c, 
+	0x20, 0x30, 0x2e, 0x32, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 
+	0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x68, 0x31, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 
+	0x30, 0x35, 0x36, 0x62, 0x33, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+	0x6e, 0x70, 0x75, 0x74, 0x5b, 0x74, 0x79, 0x70, 0x65, 0x3d, 
+	0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x5d, 0x20, 0x7b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 
+	0x3a, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 
+	0x3a, 0x20, 0x31, 0x36, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x38, 0x30, 
+	0x25, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 
+	0x65, 0x72, 0x3a, 0x20, 0x31, 0x70, 0x78, 0x20, 0x73, 0x6f, 
+	0x6c, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 0x64, 
+	0x34, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 
+	0x65, 0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 
+	0x20, 0x38, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6f, 
+	0x70, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 
+	0x3a, 0x20, 0x33, 0x32, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x20, 0x39, 0x30, 
+	0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 
+	0x67, 0x68, 0x74, 0x3a, 0x20, 0x39, 0x30, 0x70, 0x78, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 
+	0x3a, 0x20, 0x38, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x77, 0x68, 0x69, 
+	0x74, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 
+	0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 
+	0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x30, 0x30, 0x37, 0x38, 
+	0x64, 0x34, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 
+	0x64, 0x65, 0x72, 0x3a, 0x20, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 
+	0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x20, 0x31, 
+	0x32, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2e, 0x6f, 0x70, 
+	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x64, 0x69, 0x73, 0x61, 0x62, 
+	0x6c, 0x65, 0x64, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 
+	0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 
+	0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 0x23, 0x39, 0x39, 
+	0x63, 0x32, 0x65, 0x36, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x73, 
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 
+	0x3a, 0x20, 0x31, 0x38, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x6d, 0x69, 0x6e, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 
+	0x74, 0x3a, 0x20, 0x32, 0x34, 0x70, 0x78, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x74, 0x79, 
+	0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 
+	0x64, 0x3e, 0x0d, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x64, 0x69, 0x76, 
+	0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 
+	0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x68, 0x31, 0x3e, 0x51, 0x75, 0x69, 0x7a, 0x20, 0x42, 0x69, 
+	0x74, 0x42, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x3c, 0x2f, 0x68, 
+	0x31, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x70, 0x3e, 0x4c, 0x65, 0x69, 0x61, 0x20, 
+	0x61, 0x20, 0x63, 0x65, 0x6c, 0x61, 0x20, 0x6e, 0x61, 0x20, 
+	0x6d, 0x61, 0x74, 0x72, 0x69, 0x7a, 0x20, 0x65, 0x20, 0x65, 
+	0x73, 0x63, 0x6f, 0x6c, 0x68, 0x61, 0x20, 0x61, 0x20, 0x6c, 
+	0x65, 0x74, 0x72, 0x61, 0x2e, 0x3c, 0x2f, 0x70, 0x3e, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 
+	0x3d, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x69, 0x64, 
+	0x3d, 0x22, 0x6e, 0x6f, 0x6d, 0x65, 0x22, 0x20, 0x6d, 0x61, 
+	0x78, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3d, 0x22, 0x31, 
+	0x35, 0x22, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 
+	0x6c, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x53, 0x65, 0x75, 0x20, 
+	0x6e, 0x6f, 0x6d, 0x65, 0x22, 0x3e, 0x3c, 0x62, 0x72, 0x3e, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6f, 
+	0x70, 0x63, 0x6f, 0x65, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 
+	0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x70, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3e, 0x41, 0x67, 
+	0x75, 0x61, 0x72, 0x64, 0x61, 0x6e, 0x64, 0x6f, 0x20, 0x72, 
+	0x6f, 0x64, 0x61, 0x64, 0x61, 0x2e, 0x2e, 0x2e, 0x3c, 0x2f, 
+	0x70, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x3c, 0x6f, 0x6c, 0x20, 0x69, 0x64, 0x3d, 0x22, 
+	0x72, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x22, 0x3e, 0x3c, 
+	0x2f, 0x6f, 0x6c, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6e, 0x6f, 
+	0x6d, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 
+	0x6e, 0x6f, 0x6d, 0x65, 0x27, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x6f, 0x6d, 
+	0x65, 0x2e, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 
+	0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 
+	0x67, 0x65, 0x2e, 0x67, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 
+	0x28, 0x27, 0x71, 0x75, 0x69, 0x7a, 0x4e, 0x6f, 0x6d, 0x65, 
+	0x27, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x27, 0x27, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 
+	0x65, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x3d, 
+	0x20, 0x2d, 0x31, 0x2c, 0x20, 0x61, 0x6e, 0x73, 0x77, 0x65, 
+	0x72, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 
+	0x65, 0x3b, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x49, 0x64, 0x20, 
+	0x61, 0x63, 0x65, 0x69, 0x74, 0x6f, 0x20, 0x70, 0x65, 0x6c, 
+	0x61, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x61, 0x3a, 0x20, 0x6c, 
+	0x65, 0x74, 0x72, 0x61, 0x73, 0x2c, 0x20, 0x6e, 0xc3, 0xba, 
+	0x6d, 0x65, 0x72, 0x6f, 0x73, 0x2c, 0x20, 0x27, 0x2d, 0x27, 
+	0x20, 0x65, 0x20, 0x27, 0x5f, 0x27, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6c, 0x69, 0x65, 0x6e, 
+	0x74, 0x49, 0x64, 0x28, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x64, 0x20, 
+	0x3d, 0x20, 0x6e, 0x6f, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x2e, 0x74, 0x72, 0x69, 0x6d, 0x28, 0x29, 0x2e, 
+	0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x5b, 
+	0x5e, 0x41, 0x2d, 0x5a, 0x61, 0x2d, 0x7a, 0x30, 0x2d, 0x39, 
+	0x5f, 0x2d, 0x5d, 0x2f, 0x67, 0x2c, 0x20, 0x27, 0x5f, 0x27, 
+	0x29, 0x2e, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2c, 
+	0x20, 0x31, 0x35, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 
+	0x6f, 0x63, 0x61, 0x6c, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 
+	0x65, 0x2e, 0x73, 0x65, 0x74, 0x49, 0x74, 0x65, 0x6d, 0x28, 
+	0x27, 0x71, 0x75, 0x69, 0x7a, 0x4e, 0x6f, 0x6d, 0x65, 0x27, 
+	0x2c, 0x20, 0x6e, 0x6f, 0x6d, 0x65, 0x2e, 0x76, 0x61, 0x6c, 
+	0x75, 0x65, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x69, 0x64, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 
+	0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 
+	0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x61, 0x6e, 0x73, 0x77, 
+	0x65, 0x72, 0x28, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x29, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 
+	0x74, 0x20, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x69, 
+	0x65, 0x6e, 0x74, 0x49, 0x64, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x69, 0x64, 0x29, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 
+	0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 
+	0x79, 0x49, 0x64, 0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 
+	0x73, 0x27, 0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x27, 0x44, 
+	0x69, 0x67, 0x69, 0x74, 0x65, 0x20, 0x73, 0x65, 0x75, 0x20, 
+	0x6e, 0x6f, 0x6d, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x65, 
+	0x69, 0x72, 0x6f, 0x2e, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x65, 0x64, 0x20, 0x3d, 
+	0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x73, 0x68, 0x6f, 0x77, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x73, 0x28, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x72, 0x65, 
+	0x73, 0x70, 0x20, 0x3d, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 
+	0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2f, 0x71, 
+	0x75, 0x69, 0x7a, 0x2e, 0x63, 0x67, 0x69, 0x3f, 0x69, 0x64, 
+	0x3d, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 
+	0x65, 0x55, 0x52, 0x49, 0x43, 0x6f, 0x6d, 0x70, 0x6f, 0x6e, 
+	0x65, 0x6e, 0x74, 0x28, 0x69, 0x64, 0x29, 0x20, 0x2b, 0x20, 
+	0x27, 0x26, 0x72, 0x3d, 0x27, 0x20, 0x2b, 0x20, 0x6c, 0x65, 
+	0x74, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x7b, 0x20, 0x63, 0x61, 
+	0x63, 0x68, 0x65, 0x3a, 0x20, 0x27, 0x6e, 0x6f, 0x2d, 0x73, 
+	0x74, 0x6f, 0x72, 0x65, 0x27, 0x20, 0x7d, 0x29, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x74, 
+	0x65, 0x78, 0x74, 0x20, 0x3d, 0x20, 0x61, 0x77, 0x61, 0x69, 
+	0x74, 0x20, 0x72, 0x65, 0x73, 0x70, 0x2e, 0x74, 0x65, 0x78, 
+	0x74, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 
+	0x29, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 
+	0x65, 0x6e, 0x74, 0x20, 0x3d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x3d, 0x3d, 
+	0x3d, 0x20, 0x27, 0x6f, 0x6b, 0x27, 0x20, 0x3f, 0x20, 0x27, 
+	0x52, 0x65, 0x73, 0x70, 0x6f, 0x73, 0x74, 0x61, 0x20, 0x27, 
+	0x20, 0x2b, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 
+	0x2b, 0x20, 0x27, 0x20, 0x65, 0x6e, 0x76, 0x69, 0x61, 0x64, 
+	0x61, 0x21, 0x27, 0x20, 0x3a, 0x20, 0x27, 0x52, 0x65, 0x73, 
+	0x70, 0x6f, 0x73, 0x74, 0x61, 0x20, 0x27, 0x20, 0x2b, 0x20, 
+	0x74, 0x65, 0x78, 0x74, 0x20, 0x2b, 0x20, 0x27, 0x2e, 0x27, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x0d, 0x0a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 
+	0x6f, 0x6e, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x4f, 0x70, 0x74, 
+	0x69, 0x6f, 0x6e, 0x73, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x73, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x64, 0x69, 0x76, 0x20, 0x3d, 
+	0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 
+	0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 
+	0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6f, 0x70, 0x63, 0x6f, 
+	0x65, 0x73, 0x27, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 
+	0x69, 0x76, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x3b, 0x0d, 0x0a, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x63, 0x6f, 0x6e, 
+	0x73, 0x74, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 
+	0x6f, 0x66, 0x20, 0x28, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x73, 0x20, 0x7c, 0x7c, 0x20, 0x27, 0x27, 0x29, 0x29, 0x20, 
+	0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 
+	0x6f, 0x6e, 0x73, 0x74, 0x20, 0x62, 0x20, 0x3d, 0x20, 0x64, 
+	0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x63, 0x72, 
+	0x65, 0x61, 0x74, 0x65, 0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 
+	0x74, 0x28, 0x27, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x27, 
+	0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x62, 0x2e, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x4e, 0x61, 0x6d, 
+	0x65, 0x20, 0x3d, 0x20, 0x27, 0x6f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x62, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 
+	0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x65, 0x74, 
+	0x74, 0x65, 0x72, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x2e, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6c, 
+	0x65, 0x64, 0x20, 0x3d, 0x20, 0x61, 0x6e, 0x73, 0x77, 0x65, 
+	0x72, 0x65, 0x64, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x62, 0x2e, 0x6f, 0x6e, 0x63, 0x6c, 0x69, 0x63, 
+	0x6b, 0x20, 0x3d, 0x20, 0x28, 0x29, 0x20, 0x3d, 0x3e, 0x20, 
+	0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x28, 0x6c, 0x65, 0x74, 
+	0x74, 0x65, 0x72, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x64, 0x69, 0x76, 0x2e, 0x61, 0x70, 0x70, 
+	0x65, 0x6e, 0x64, 0x43, 0x68, 0x69, 0x6c, 0x64, 0x28, 0x62, 
+	0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0d, 0x0a, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x61, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x66, 0x75, 0x6e, 0x63, 
+	0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6f, 0x6c, 0x6c, 0x28, 
+	0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x79, 
+	0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x71, 0x20, 0x3d, 0x20, 
+	0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x28, 0x61, 0x77, 0x61, 
+	0x69, 0x74, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 
+	0x27, 0x2c, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 
+	0x3a, 0x20, 0x27, 0x6e, 0x6f, 0x2d, 0x73, 0x74, 0x6f, 0x72, 
+	0x65, 0x27, 0x20, 0x7d, 0x29, 0x29, 0x2e, 0x6a, 0x73, 0x6f, 
+	0x6e, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x71, 0x2e, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x20, 0x21, 0x3d, 0x3d, 0x20, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x71, 0x2e, 0x72, 0x6f, 
+	0x75, 0x6e, 0x64, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x6e, 0x73, 0x77, 
+	0x65, 0x72, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 
+	0x73, 0x65, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 
+	0x72, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x27, 0x29, 0x2e, 
+	0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 0x4d, 0x4c, 0x20, 
+	0x3d, 0x20, 0x27, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 
+	0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x20, 0x3d, 0x20, 0x71, 0x2e, 0x6f, 0x70, 0x65, 
+	0x6e, 0x20, 0x3f, 0x20, 0x27, 0x4e, 0x6f, 0x76, 0x61, 0x20, 
+	0x72, 0x6f, 0x64, 0x61, 0x64, 0x61, 0x21, 0x27, 0x20, 0x3a, 
+	0x20, 0x27, 0x41, 0x67, 0x75, 0x61, 0x72, 0x64, 0x61, 0x6e, 
+	0x64, 0x6f, 0x20, 0x72, 0x6f, 0x64, 0x61, 0x64, 0x61, 0x2e, 
+	0x2e, 0x2e, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x73, 0x68, 0x6f, 0x77, 0x4f, 0x70, 0x74, 0x69, 0x6f, 
+	0x6e, 0x73, 0x28, 0x71, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x20, 
+	0x3f, 0x20, 0x71, 0x2e, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 
+	0x73, 0x20, 0x3a, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+	0x20, 0x28, 0x21, 0x71, 0x2e, 0x6f, 0x70, 0x65, 0x6e, 0x20, 
+	0x26, 0x26, 0x20, 0x71, 0x2e, 0x72, 0x61, 0x6e, 0x6b, 0x69, 
+	0x6e, 0x67, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 
+	0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 
+	0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 
+	0x28, 0x27, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 
+	0x2e, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 
+	0x6e, 0x74, 0x20, 0x3d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x27, 0x52, 0x65, 0x73, 0x70, 0x6f, 0x73, 0x74, 0x61, 0x20, 
+	0x63, 0x65, 0x72, 0x74, 0x61, 0x3a, 0x20, 0x27, 0x20, 0x2b, 
+	0x20, 0x71, 0x2e, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 
+	0x2b, 0x20, 0x27, 0x20, 0x28, 0x27, 0x20, 0x2b, 0x20, 0x71, 
+	0x2e, 0x63, 0x6f, 0x72, 0x72, 0x65, 0x63, 0x74, 0x20, 0x2b, 
+	0x20, 0x27, 0x20, 0x64, 0x65, 0x20, 0x27, 0x20, 0x2b, 0x20, 
+	0x71, 0x2e, 0x61, 0x6e, 0x73, 0x77, 0x65, 0x72, 0x73, 0x20, 
+	0x2b, 0x20, 0x27, 0x20, 0x61, 0x63, 0x65, 0x72, 0x74, 0x61, 
+	0x72, 0x61, 0x6d, 0x29, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 
+	0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 
+	0x45, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 
+	0x64, 0x28, 0x27, 0x72, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 
+	0x27, 0x29, 0x2e, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x48, 0x54, 
+	0x4d, 0x4c, 0x20, 0x3d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x71, 0x2e, 0x72, 0x61, 0x6e, 0x6b, 0x69, 0x6e, 0x67, 0x2e, 
+	0x6d, 0x61, 0x70, 0x28, 0x65, 0x20, 0x3d, 0x3e, 0x20, 0x27, 
+	0x3c, 0x6c, 0x69, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x65, 0x2e, 
+	0x69, 0x64, 0x20, 0x2b, 0x20, 0x27, 0x20, 0x2d, 0x20, 0x27, 
+	0x20, 0x2b, 0x20, 0x65, 0x2e, 0x6d, 0x73, 0x20, 0x2b, 0x20, 
+	0x27, 0x20, 0x6d, 0x73, 0x3c, 0x2f, 0x6c, 0x69, 0x3e, 0x27, 
+	0x29, 0x2e, 0x6a, 0x6f, 0x69, 0x6e, 0x28, 0x27, 0x27, 0x29, 
+	0x3b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x61, 0x74, 0x63, 
+	0x68, 0x20, 0x28, 0x65, 0x29, 0x20, 0x7b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x63, 0x75, 0x6d, 
+	0x65, 0x6e, 0x74, 0x2e, 0x67, 0x65, 0x74, 0x45, 0x6c, 0x65, 
+	0x6d, 0x65, 0x6e, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 
+	0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x2e, 0x74, 
+	0x65, 0x78, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 
+	0x20, 0x3d, 0x20, 0x27, 0x53, 0x65, 0x6d, 0x20, 0x63, 0x6f, 
+	0x6e, 0x65, 0x78, 0x61, 0x6f, 0x27, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x7d, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 
+	0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x70, 0x6f, 0x6c, 
+	0x6c, 0x2c, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x0d, 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 
+	0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+	0x70, 0x6f, 0x6c, 0x6c, 0x28, 0x29, 0x3b, 0x0d, 0x0a, 0x20, 
+	0x20, 0x20, 0x20, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 
+	0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 
+	0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+	0x0d, 0x0a, };
+
+static const unsigned char data_quiz_dup_txt[] = {
+	/* ./quiz_dup.txt */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x5f, 0x64, 0x75, 0x70, 0x2e, 0x74, 0x78, 0x74, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	
+	0x72, 0x65, 0x70, 0x65, 0x74, 0x69, 0x64, 0x61, };
+
+static const unsigned char data_quiz_ok_txt[] = {
+	/* ./quiz_ok.txt */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x5f, 0x6f, 0x6b, 0x2e, 0x74, 0x78, 0x74, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	
+	0x6f, 0x6b, };
+
+static const unsigned char data_quiz_full_txt[] = {
+	/* ./quiz_full.txt */
+	0x2f, 0x71, 0x75, 0x69, 0x7a, 0x5f, 0x66, 0x75, 0x6c, 0x6c, 0x2e, 0x74, 0x78, 0x74, 0,
+	0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x30, 0x20, 0x32, 
+	0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x53, 0x65, 0x72, 
+	0x76, 0x65, 0x72, 0x3a, 0x20, 0x6c, 0x77, 0x49, 0x50, 0x2f, 
+	0x70, 0x72, 0x65, 0x2d, 0x30, 0x2e, 0x36, 0x20, 0x28, 0x68, 
+	0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 
+	0x73, 0x69, 0x63, 0x73, 0x2e, 0x73, 0x65, 0x2f, 0x7e, 0x61, 
+	0x64, 0x61, 0x6d, 0x2f, 0x6c, 0x77, 0x69, 0x70, 0x2f, 0x29, 
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 
+	0x74, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 
+	0x2f, 0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0d, 0x0a, 0x0d, 0x0a, 
+	
+	0x63, 0x68, 0x65, 0x69, 0x6f, };
 
-const struct fsdata_file file_index_shtml[] = {
-    { NULL, data_index_shtml, data_index_shtml + 13, sizeof(data_index_shtml) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT }
-};
+const struct fsdata_file file_mirror_html[] = {{ NULL, data_mirror_html, data_mirror_html + 13, sizeof(data_mirror_html) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_closed_txt[] = {{ file_mirror_html, data_quiz_closed_txt, data_quiz_closed_txt + 17, sizeof(data_quiz_closed_txt) - 17, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_index_shtml[] = {{ file_quiz_closed_txt, data_index_shtml, data_index_shtml + 13, sizeof(data_index_shtml) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_err_txt[] = {{ file_index_shtml, data_quiz_err_txt, data_quiz_err_txt + 14, sizeof(data_quiz_err_txt) - 14, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_html[] = {{ file_quiz_err_txt, data_quiz_html, data_quiz_html + 11, sizeof(data_quiz_html) - 11, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_dup_txt[] = {{ file_quiz_html, data_quiz_dup_txt, data_quiz_dup_txt + 14, sizeof(data_quiz_dup_txt) - 14, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_ok_txt[] = {{ file_quiz_dup_txt, data_quiz_ok_txt, data_quiz_ok_txt + 13, sizeof(data_quiz_ok_txt) - 13, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
+const struct fsdata_file file_quiz_full_txt[] = {{ file_quiz_ok_txt, data_quiz_full_txt, data_quiz_full_txt + 15, sizeof(data_quiz_full_txt) - 15, FS_FILE_FLAGS_HEADER_INCLUDED | FS_FILE_FLAGS_HEADER_PERSISTENT}};
 
-#define FS_ROOT file_index_shtml
-#define FS_NUMFILES 1
+#define FS_ROOT file_quiz_full_txt
+#define FS_NUMFILES 8
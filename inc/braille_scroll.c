@@ -0,0 +1,165 @@
+#include <ctype.h>
+#include "braille_scroll.h"
+
+// Converte os 6 pontos de uma cela em duas colunas (esquerda: 1-3, direita: 4-6)
+static void cell_to_columns(const uint8_t dots[6], uint8_t *left, uint8_t *right) {
+  *left = 0;
+  *right = 0;
+  for (uint8_t i = 0; i < 3; ++i) {
+    if (dots[i])
+      *left |= 1 << (SCROLL_TOP_ROW + i);
+    if (dots[i + 3])
+      *right |= 1 << (SCROLL_TOP_ROW + i);
+  }
+}
+
+// Escreve uma coluna da fita na coluna "col" da janela
+static void put_column(braille_scroll_t *s, uint16_t col, uint8_t mask) {
+  for (uint8_t r = 0; r < SCROLL_ROWS; ++r) {
+    int i = s->index(col, r);
+    if (i >= 0)
+      s->leds[i] = (mask & (1 << r)) ? s->color : 0x000000;
+  }
+}
+
+void braille_scroll_init(braille_scroll_t *s, uint32_t *leds, braille_scroll_index_fn index, uint16_t cols,
+                         const uint8_t cells[26][6], uint32_t color) {
+  s->active = false;
+  s->strip_len = 0;
+  s->offset = 0;
+  s->step_ms = SCROLL_STEP_MS;
+  s->color = color;
+  s->leds = leds;
+  s->index = index;
+  s->cols = cols < SCROLL_MAX_COLS ? cols : SCROLL_MAX_COLS;
+  s->cells = cells;
+}
+
+void braille_scroll_set_speed(braille_scroll_t *s, uint32_t step_ms) {
+  s->step_ms = step_ms ? step_ms : 1;
+}
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  c = (char) toupper((unsigned char) c);
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+// Próximo byte da palavra já sem a codificação da URL (o CGI do lwIP entrega
+// o valor cru): "%XX" vira o byte XX e '+' vira espaço
+static uint8_t next_byte(const char **p) {
+  const char *w = *p;
+  if (w[0] == '%' && hex_value(w[1]) >= 0 && hex_value(w[2]) >= 0) {
+    *p = w + 3;
+    return (uint8_t) (hex_value(w[1]) << 4 | hex_value(w[2]));
+  }
+  *p = w + 1;
+  return w[0] == '+' ? ' ' : (uint8_t) w[0];
+}
+
+// Letras acentuadas em UTF-8 (0xC3 0x80..0xBF = U+00C0..U+00FF) viram a
+// letra sem acento: "ç" -> C, "ã" -> A. '?' = sem equivalente (pulado)
+static const char latin1_letters[] = "AAAAAA?CEEEEIIIIDNOOOOO?OUUUUY??";
+
+// Próximo caractere A-Z ou espaço; 0 no fim. Demais bytes são pulados.
+static char next_letter(const char **p) {
+  while (**p) {
+    uint8_t b = next_byte(p);
+    if (b == 0xC3 && **p) {
+      const char *peek = *p;
+      uint8_t cont = next_byte(&peek);
+      if (cont >= 0x80 && cont <= 0xBF) {
+        *p = peek;
+        char c = (cont == 0xBF) ? 'Y' : latin1_letters[cont & 0x1F];
+        if (c != '?')
+          return c;
+        continue;
+      }
+    }
+    char c = (char) toupper(b);
+    if ((c >= 'A' && c <= 'Z') || c == ' ')
+      return c;
+  }
+  return 0;
+}
+
+bool braille_scroll_start(braille_scroll_t *s, const char *word) {
+  uint16_t n = 0;
+
+  if (s->cols == 0)
+    return false;
+
+  // Entrada pela direita: a primeira coluna útil aparece na última coluna da janela
+  for (uint16_t i = 0; i < s->cols - 1; ++i)
+    s->strip[n++] = 0;
+
+  // Só letras (sem acento) e espaço; o resto da palavra é pulado
+  uint8_t count = 0;
+  char c;
+  while (count < SCROLL_MAX_CELLS && (c = next_letter(&word)) != 0) {
+    uint8_t left = 0, right = 0;
+    if (c != ' ')
+      cell_to_columns(s->cells[c - 'A'], &left, &right);
+
+    s->strip[n++] = left;
+    s->strip[n++] = right;
+    s->strip[n++] = 0; // espaço entre celas
+    ++count;
+  }
+  if (count == 0)
+    return false;
+
+  // Saída pela esquerda
+  for (uint16_t i = 0; i < s->cols; ++i)
+    s->strip[n++] = 0;
+
+  s->strip_len = n;
+  s->offset = 0;
+  s->active = true;
+
+  // Primeiro quadro: única renderização completa da janela
+  for (uint16_t col = 0; col < s->cols; ++col)
+    put_column(s, col, s->strip[col]);
+  s->next_step = make_timeout_time_ms(s->step_ms);
+  return true;
+}
+
+void braille_scroll_stop(braille_scroll_t *s) {
+  s->active = false;
+}
+
+// Avança a rolagem quando o passo vence; retorna true se o quadro mudou
+bool braille_scroll_update(braille_scroll_t *s) {
+  if (!s->active || !time_reached(s->next_step))
+    return false;
+
+  if (s->offset + s->cols >= s->strip_len) {
+    s->active = false;
+    return false;
+  }
+  s->offset++;
+
+  // Desloca as colunas visíveis uma posição para a esquerda. Onde a coluna
+  // da direita não existe (vão entre painéis) o valor vem da fita.
+  for (uint16_t col = 0; col + 1 < s->cols; ++col) {
+    for (uint8_t r = 0; r < SCROLL_ROWS; ++r) {
+      int dst = s->index(col, r);
+      if (dst < 0)
+        continue;
+      int src = s->index(col + 1, r);
+      if (src >= 0)
+        s->leds[dst] = s->leds[src];
+      else
+        s->leds[dst] = (s->strip[s->offset + col] & (1 << r)) ? s->color : 0x000000;
+    }
+  }
+
+  // Só a coluna nova é lida da fita
+  put_column(s, s->cols - 1, s->strip[s->offset + s->cols - 1]);
+
+  s->next_step = delayed_by_ms(s->next_step, s->step_ms);
+  return true;
+}
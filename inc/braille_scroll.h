@@ -0,0 +1,59 @@
+#ifndef BRAILLE_SCROLL_H
+#define BRAILLE_SCROLL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+// Linhas usadas da tela lógica dos LEDs; a largura da janela vem dos
+// painéis (led_panels_width), até SCROLL_MAX_COLS
+#define SCROLL_ROWS          5
+#define SCROLL_MAX_COLS      64
+
+// Cada cela Braille ocupa 2 colunas + 1 coluna de espaço
+#define SCROLL_CELL_COLS     3
+#define SCROLL_MAX_CELLS     32
+// Colunas em branco antes (entrada pela direita) e depois (saída pela esquerda)
+#define SCROLL_MAX_STRIP     (SCROLL_MAX_COLS - 1 + SCROLL_MAX_CELLS * SCROLL_CELL_COLS + SCROLL_MAX_COLS)
+
+// Velocidade padrão: tempo de cada passo de uma coluna
+#define SCROLL_STEP_MS       150
+
+// Linha da matriz onde fica o ponto 1 (pontos 1-3 ocupam linhas 1..3)
+#define SCROLL_TOP_ROW       1
+
+// ---------------------------------------------------------------------
+// Renderizador com rolagem horizontal de várias celas Braille.
+//
+// A palavra é convertida uma única vez em uma "fita" de colunas
+// (cada coluna é uma máscara de 5 bits, bit r = linha r acesa).
+// A cada passo a janela anda uma coluna: as colunas visíveis são
+// deslocadas dentro de led_matrix e apenas a coluna nova é escrita.
+// (x, y) da tela lógica viram posições do framebuffer pela função
+// "index" (led_panels_index); posições fora dos painéis (-1) são puladas.
+// ---------------------------------------------------------------------
+typedef int (*braille_scroll_index_fn)(uint16_t x, uint16_t y);
+
+typedef struct {
+  bool active;
+  uint8_t strip[SCROLL_MAX_STRIP];
+  uint16_t strip_len;
+  uint16_t offset;           // primeira coluna da fita visível na janela
+  uint32_t step_ms;
+  uint32_t color;
+  absolute_time_t next_step;
+
+  uint32_t *leds;            // framebuffer de todos os painéis
+  braille_scroll_index_fn index;
+  uint16_t cols;             // largura da janela
+  const uint8_t (*cells)[6]; // braille_map (A-Z)
+} braille_scroll_t;
+
+void braille_scroll_init(braille_scroll_t *s, uint32_t *leds, braille_scroll_index_fn index, uint16_t cols,
+                         const uint8_t cells[26][6], uint32_t color);
+void braille_scroll_set_speed(braille_scroll_t *s, uint32_t step_ms);
+bool braille_scroll_start(braille_scroll_t *s, const char *word);
+void braille_scroll_stop(braille_scroll_t *s);
+bool braille_scroll_update(braille_scroll_t *s);
+
+#endif
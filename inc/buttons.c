@@ -0,0 +1,123 @@
+#include "buttons.h"
+
+typedef struct {
+  uint8_t gpio;
+  bool pressed;              // estado estável (após debounce)
+  volatile bool debouncing;
+  uint64_t edge_us;          // instante da borda que iniciou o debounce
+  alarm_id_t long_alarm;
+} button_t;
+
+static button_t buttons[BUTTONS_MAX];
+static uint8_t button_count = 0;
+
+static button_event_t queue[BUTTON_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0;   // escrito só nas IRQs
+static volatile uint32_t queue_tail = 0;   // escrito só no loop principal
+static volatile uint32_t queue_dropped = 0;
+
+// Tudo que roda nas IRQs de GPIO e alarme fica na SRAM (latência sem cache miss)
+static button_t *__time_critical_func(find_button)(uint gpio) {
+  for (uint8_t i = 0; i < button_count; ++i)
+    if (buttons[i].gpio == gpio)
+      return &buttons[i];
+  return NULL;
+}
+
+// GPIO e alarmes têm a mesma prioridade de IRQ: um produtor por vez
+static void __time_critical_func(push_event)(button_t *b, uint8_t type, uint64_t time_us) {
+  uint32_t head = queue_head;
+  if (head - queue_tail >= BUTTON_QUEUE_SIZE) {
+    queue_dropped++;
+    return;
+  }
+  button_event_t *ev = &queue[head & (BUTTON_QUEUE_SIZE - 1)];
+  ev->time_us = time_us;
+  ev->gpio = b->gpio;
+  ev->type = type;
+  queue_head = head + 1;
+}
+
+static int64_t __time_critical_func(long_press_alarm)(alarm_id_t id, void *user_data) {
+  button_t *b = (button_t *) user_data;
+  b->long_alarm = 0;
+  if (b->pressed)
+    push_event(b, BUTTON_LONG_PRESS, time_us_64());
+  return 0;
+}
+
+static int64_t __time_critical_func(debounce_alarm)(alarm_id_t id, void *user_data) {
+  button_t *b = (button_t *) user_data;
+  bool pressed = !gpio_get(b->gpio);   // ativo em nível baixo (pull-up)
+  b->debouncing = false;
+
+  if (pressed == b->pressed)
+    return 0;   // só ruído: voltou ao estado anterior
+  b->pressed = pressed;
+
+  if (pressed) {
+    push_event(b, BUTTON_PRESS, b->edge_us);
+    uint64_t elapsed = time_us_64() - b->edge_us;
+    uint64_t remaining = elapsed < BUTTON_LONG_PRESS_US ? BUTTON_LONG_PRESS_US - elapsed : 0;
+    alarm_id_t id_long = add_alarm_in_us(remaining, long_press_alarm, b, true);
+    b->long_alarm = id_long > 0 ? id_long : 0;
+  } else {
+    if (b->long_alarm) {
+      cancel_alarm(b->long_alarm);
+      b->long_alarm = 0;
+    }
+    push_event(b, BUTTON_RELEASE, b->edge_us);
+  }
+  return 0;
+}
+
+void buttons_init(void) {
+  button_count = 0;
+  queue_head = queue_tail = queue_dropped = 0;
+}
+
+// Configura o pino (entrada com pull-up) e habilita IRQ nas duas bordas.
+// O callback de GPIO deve repassar os eventos para buttons_gpio_irq().
+bool buttons_add(uint gpio) {
+  if (button_count >= BUTTONS_MAX)
+    return false;
+
+  gpio_init(gpio);
+  gpio_set_dir(gpio, GPIO_IN);
+  gpio_pull_up(gpio);
+
+  button_t *b = &buttons[button_count++];
+  b->gpio = gpio;
+  b->pressed = false;
+  b->debouncing = false;
+  b->long_alarm = 0;
+
+  gpio_set_irq_enabled(gpio, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true);
+  return true;
+}
+
+// Contexto de IRQ: só carimba o tempo e agenda o debounce (sem sleep)
+void __time_critical_func(buttons_gpio_irq)(uint gpio, uint32_t events) {
+  button_t *b = find_button(gpio);
+  if (b == NULL || b->debouncing)
+    return;
+
+  b->edge_us = time_us_64();
+  b->debouncing = true;
+  if (add_alarm_in_us(BUTTON_DEBOUNCE_US, debounce_alarm, b, true) <= 0)
+    b->debouncing = false;   // sem slot de alarme: a próxima borda tenta de novo
+}
+
+// Loop principal: retira o próximo evento da fila
+bool buttons_poll(button_event_t *ev) {
+  uint32_t tail = queue_tail;
+  if (tail == queue_head)
+    return false;
+  *ev = queue[tail & (BUTTON_QUEUE_SIZE - 1)];
+  queue_tail = tail + 1;
+  return true;
+}
+
+uint32_t buttons_dropped(void) {
+  return queue_dropped;
+}
@@ -0,0 +1,40 @@
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------
+// Entrada dos botões com debounce por alarme de hardware.
+//
+// A IRQ de GPIO só marca o instante da primeira borda (time_us_64) e
+// agenda um alarme; quando o alarme vence, o nível é lido de novo e,
+// se mudou de forma estável, o evento é colocado numa fila circular
+// estática (produtor: IRQs, consumidor: loop principal).
+// ---------------------------------------------------------------------
+
+#define BUTTONS_MAX            4
+#define BUTTON_DEBOUNCE_US     20000    // 20 ms
+#define BUTTON_LONG_PRESS_US   800000   // 800 ms
+#define BUTTON_QUEUE_SIZE      32       // potência de 2
+
+typedef enum {
+  BUTTON_PRESS = 0,
+  BUTTON_LONG_PRESS,
+  BUTTON_RELEASE,
+} button_event_type_t;
+
+typedef struct {
+  uint64_t time_us;   // instante da primeira borda (antes do debounce)
+  uint8_t gpio;
+  uint8_t type;       // button_event_type_t
+} button_event_t;
+
+void buttons_init(void);
+bool buttons_add(uint gpio);
+void buttons_gpio_irq(uint gpio, uint32_t events);
+bool buttons_poll(button_event_t *ev);
+uint32_t buttons_dropped(void);
+
+#endif
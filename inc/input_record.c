@@ -0,0 +1,221 @@
+#include <string.h>
+#include "input_record.h"
+
+// ---------------------------------------------------------------------
+// Gravação
+// ---------------------------------------------------------------------
+static void write_header(input_recorder_t *r) {
+  memcpy(r->buf, INPUT_RECORD_MAGIC, 4);
+  r->buf[4] = INPUT_RECORD_VERSION;
+  r->buf[5] = r->buf[6] = r->buf[7] = 0;
+  r->buf[8] = (uint8_t) r->count;
+  r->buf[9] = (uint8_t) (r->count >> 8);
+  r->buf[10] = (uint8_t) (r->count >> 16);
+  r->buf[11] = (uint8_t) (r->count >> 24);
+}
+
+void input_record_start(input_recorder_t *r, uint8_t *buf, size_t cap, uint64_t now_us) {
+  r->buf = buf;
+  r->cap = cap;
+  r->len = INPUT_RECORD_HEADER;
+  r->count = 0;
+  r->start_us = now_us;
+  r->last_us = now_us;
+  r->full = cap < INPUT_RECORD_HEADER;
+  r->active = !r->full;
+  if (r->active)
+    write_header(r);
+}
+
+// Reserva espaço para um evento: tipo + delta (até 10 bytes) + "payload" bytes
+static uint8_t *begin_event(input_recorder_t *r, uint64_t now_us, uint8_t type, size_t payload) {
+  if (!r->active)
+    return NULL;
+
+  uint8_t tmp[11];
+  size_t n = 0;
+  uint64_t delta = now_us > r->last_us ? now_us - r->last_us : 0;
+  tmp[n++] = type;
+  do {
+    uint8_t b = delta & 0x7F;
+    delta >>= 7;
+    tmp[n++] = b | (delta ? 0x80 : 0);
+  } while (delta);
+
+  if (r->len + n + payload > r->cap) {
+    r->active = false;
+    r->full = true;
+    return NULL;
+  }
+  memcpy(r->buf + r->len, tmp, n);
+  r->len += n;
+  r->last_us = now_us > r->last_us ? now_us : r->last_us;
+  r->count++;
+
+  uint8_t *out = r->buf + r->len;
+  r->len += payload;
+  return out;
+}
+
+bool input_record_adc(input_recorder_t *r, uint64_t now_us, uint16_t value) {
+  uint8_t *p = begin_event(r, now_us, INPUT_ADC, 2);
+  if (p == NULL)
+    return false;
+  p[0] = (uint8_t) value;
+  p[1] = (uint8_t) (value >> 8);
+  return true;
+}
+
+bool input_record_button(input_recorder_t *r, uint64_t now_us, uint8_t gpio, uint8_t event) {
+  uint8_t *p = begin_event(r, now_us, INPUT_BUTTON, 2);
+  if (p == NULL)
+    return false;
+  p[0] = gpio;
+  p[1] = event;
+  return true;
+}
+
+bool input_record_cgi(input_recorder_t *r, uint64_t now_us, const char *param, const char *value) {
+  size_t lp = strlen(param), lv = strlen(value);
+  if (lp > INPUT_CGI_MAX) lp = INPUT_CGI_MAX;
+  if (lv > INPUT_CGI_MAX) lv = INPUT_CGI_MAX;
+
+  uint8_t *p = begin_event(r, now_us, INPUT_CGI, 2 + lp + lv);
+  if (p == NULL)
+    return false;
+  *p++ = (uint8_t) lp;
+  memcpy(p, param, lp);
+  p += lp;
+  *p++ = (uint8_t) lv;
+  memcpy(p, value, lv);
+  return true;
+}
+
+bool input_record_decision(input_recorder_t *r, uint64_t now_us, char kind, uint8_t option) {
+  uint8_t *p = begin_event(r, now_us, INPUT_DECISION, 2);
+  if (p == NULL)
+    return false;
+  p[0] = (uint8_t) kind;
+  p[1] = option;
+  return true;
+}
+
+// Fecha a gravação (atualiza o total no cabeçalho) e devolve o tamanho em bytes
+size_t input_record_stop(input_recorder_t *r) {
+  r->active = false;
+  if (r->cap < INPUT_RECORD_HEADER)
+    return 0;
+  write_header(r);
+  return r->len;
+}
+
+// ---------------------------------------------------------------------
+// Reprodução
+// ---------------------------------------------------------------------
+static bool read_event(input_replayer_t *p, input_event_t *ev) {
+  if (p->remaining == 0 || p->pos >= p->len)
+    return false;
+
+  const uint8_t *b = p->buf;
+  size_t pos = p->pos;
+  ev->type = b[pos++];
+
+  uint64_t delta = 0;
+  for (uint8_t shift = 0; ; shift += 7) {
+    if (pos >= p->len || shift > 63)
+      return false;
+    uint8_t c = b[pos++];
+    delta |= (uint64_t) (c & 0x7F) << shift;
+    if (!(c & 0x80))
+      break;
+  }
+  ev->t_us = p->last_t_us + delta;
+
+  switch (ev->type) {
+  case INPUT_ADC:
+    if (pos + 2 > p->len) return false;
+    ev->adc = (uint16_t) (b[pos] | (b[pos + 1] << 8));
+    pos += 2;
+    break;
+  case INPUT_BUTTON:
+    if (pos + 2 > p->len) return false;
+    ev->button.gpio = b[pos];
+    ev->button.event = b[pos + 1];
+    pos += 2;
+    break;
+  case INPUT_DECISION:
+    if (pos + 2 > p->len) return false;
+    ev->decision.kind = (char) b[pos];
+    ev->decision.option = b[pos + 1];
+    pos += 2;
+    break;
+  case INPUT_CGI:
+    for (int k = 0; k < 2; ++k) {
+      char *dst = k == 0 ? ev->cgi.param : ev->cgi.value;
+      if (pos >= p->len) return false;
+      uint8_t n = b[pos++];
+      if (n > INPUT_CGI_MAX || pos + n > p->len) return false;
+      memcpy(dst, b + pos, n);
+      dst[n] = '\0';
+      pos += n;
+    }
+    break;
+  default:
+    return false;
+  }
+
+  p->pos = pos;
+  p->last_t_us = ev->t_us;
+  p->remaining--;
+  return true;
+}
+
+bool input_replay_start(input_replayer_t *p, const uint8_t *buf, size_t len, uint16_t speed_pct, uint64_t now_us) {
+  p->active = false;
+  if (len < INPUT_RECORD_HEADER || memcmp(buf, INPUT_RECORD_MAGIC, 4) != 0 ||
+      buf[4] < 1 || buf[4] > INPUT_RECORD_VERSION)
+    return false;
+
+  p->buf = buf;
+  p->len = len;
+  p->pos = INPUT_RECORD_HEADER;
+  p->remaining = (uint32_t) buf[8] | ((uint32_t) buf[9] << 8) | ((uint32_t) buf[10] << 16) | ((uint32_t) buf[11] << 24);
+  p->start_us = now_us;
+  p->clock_us = 0;
+  p->last_t_us = 0;
+  p->speed_pct = speed_pct;
+  p->has_pending = read_event(p, &p->pending);
+  p->active = p->has_pending;
+  return p->active;
+}
+
+// Avança o relógio da reprodução um passo, se o tempo real (na escala de
+// velocidade) já chegou lá; com speed_pct = 0 sempre avança
+bool input_replay_tick(input_replayer_t *p, uint64_t now_us, uint64_t step_us) {
+  if (!p->active)
+    return false;
+
+  if (p->speed_pct != 0) {
+    uint64_t elapsed = (now_us - p->start_us) * p->speed_pct / 100;
+    if (elapsed < p->clock_us + step_us)
+      return false;
+  }
+  p->clock_us += step_us;
+  return true;
+}
+
+// Entrega o próximo evento se o relógio da reprodução já chegou nele
+bool input_replay_next(input_replayer_t *p, input_event_t *ev) {
+  if (!p->active || !p->has_pending || p->pending.t_us > p->clock_us)
+    return false;
+
+  *ev = p->pending;
+  p->has_pending = read_event(p, &p->pending);
+  if (!p->has_pending)
+    p->active = false;
+  return true;
+}
+
+bool input_replay_done(const input_replayer_t *p) {
+  return !p->active;
+}
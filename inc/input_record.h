@@ -0,0 +1,104 @@
+#ifndef INPUT_RECORD_H
+#define INPUT_RECORD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ---------------------------------------------------------------------
+// Gravação e reprodução determinística das entradas
+//
+// Formato compacto (little endian):
+//   cabeçalho: "BBRC", versão, 3 bytes reservados, total de eventos (u32)
+//   evento:    tipo (u8), delta de tempo em us (LEB128), dados do tipo
+//     INPUT_ADC     u16 leitura do joystick
+//     INPUT_BUTTON  u8 gpio, u8 tipo (button_event_type_t)
+//     INPUT_CGI     u8 tam + parâmetro, u8 tam + valor
+//     INPUT_DECISION u8 tipo ('o' opção, 'r' resposta), u8 opção escolhida
+//
+// As decisões são gravadas ao vivo e ignoradas na reprodução: servem para
+// conferir que a reprodução decide igual (tools/replay_host.c). A versão 1
+// não tem decisões e continua sendo lida.
+//
+// Sem dependências do SDK: o tempo é sempre passado pelo chamador, então
+// o mesmo código roda na placa e no PC (tools/replay_host.c).
+// ---------------------------------------------------------------------
+
+#define INPUT_RECORD_MAGIC    "BBRC"
+#define INPUT_RECORD_VERSION  2
+#define INPUT_RECORD_HEADER   12
+#define INPUT_CGI_MAX         32
+
+typedef enum {
+  INPUT_ADC = 1,
+  INPUT_BUTTON,
+  INPUT_CGI,
+  INPUT_DECISION,
+} input_type_t;
+
+typedef struct {
+  uint8_t type;
+  uint64_t t_us;            // tempo desde o início da gravação
+  union {
+    uint16_t adc;
+    struct {
+      uint8_t gpio;
+      uint8_t event;
+    } button;
+    struct {
+      char param[INPUT_CGI_MAX + 1];
+      char value[INPUT_CGI_MAX + 1];
+    } cgi;
+    struct {
+      char kind;
+      uint8_t option;
+    } decision;
+  };
+} input_event_t;
+
+// Gravador: escreve no buffer do chamador até ele encher
+typedef struct {
+  uint8_t *buf;
+  size_t cap;
+  size_t len;
+  uint32_t count;
+  uint64_t start_us;
+  uint64_t last_us;
+  bool active;
+  bool full;
+} input_recorder_t;
+
+void input_record_start(input_recorder_t *r, uint8_t *buf, size_t cap, uint64_t now_us);
+bool input_record_adc(input_recorder_t *r, uint64_t now_us, uint16_t value);
+bool input_record_button(input_recorder_t *r, uint64_t now_us, uint8_t gpio, uint8_t event);
+bool input_record_cgi(input_recorder_t *r, uint64_t now_us, const char *param, const char *value);
+bool input_record_decision(input_recorder_t *r, uint64_t now_us, char kind, uint8_t option);
+size_t input_record_stop(input_recorder_t *r);
+
+// Reprodutor: speed_pct = 100 para tempo real, 400 para 4x, 0 para o mais rápido possível.
+//
+// O relógio da reprodução (clock_us, em tempo gravado) anda em passos
+// fixos: quem reproduz chama input_replay_tick e, a cada passo, entrega os
+// eventos vencidos; a lógica que depende do tempo usa o t_us do evento.
+// Assim as decisões são as mesmas em qualquer velocidade; a velocidade só
+// muda quantos passos cabem em cada volta do loop.
+typedef struct {
+  const uint8_t *buf;
+  size_t len;
+  size_t pos;
+  uint32_t remaining;
+  uint64_t start_us;
+  uint64_t clock_us;
+  uint64_t last_t_us;
+  uint16_t speed_pct;
+  bool active;
+  bool has_pending;
+  input_event_t pending;
+} input_replayer_t;
+
+bool input_replay_start(input_replayer_t *p, const uint8_t *buf, size_t len, uint16_t speed_pct, uint64_t now_us);
+bool input_replay_tick(input_replayer_t *p, uint64_t now_us, uint64_t step_us);
+bool input_replay_next(input_replayer_t *p, input_event_t *ev);
+bool input_replay_done(const input_replayer_t *p);
+
+#endif
@@ -0,0 +1,35 @@
+#include "joystick.h"
+
+void joystick_gate_reset(joystick_gate_t *g) {
+  g->moved = false;
+  g->last_move_us = 0;
+}
+
+joystick_zone_t joystick_zone(uint16_t raw_x) {
+  if (raw_x < JOYSTICK_THRESHOLD_UP)
+    return JOYSTICK_UP;
+  if (raw_x > JOYSTICK_THRESHOLD_DOWN)
+    return JOYSTICK_DOWN;
+  return JOYSTICK_CENTER;
+}
+
+int joystick_select(joystick_gate_t *g, uint64_t now_us, uint16_t raw_x, int selected, int count) {
+  if (g->moved && now_us - g->last_move_us < JOYSTICK_MOVE_US)
+    return -1;
+
+  int next;
+  switch (joystick_zone(raw_x)) {
+  case JOYSTICK_UP:
+    next = (selected + 1) % count;            // sobe
+    break;
+  case JOYSTICK_DOWN:
+    next = (selected + count - 1) % count;    // desce
+    break;
+  default:
+    return -1;
+  }
+
+  g->moved = true;
+  g->last_move_us = now_us;
+  return next;
+}
@@ -0,0 +1,41 @@
+#ifndef JOYSTICK_H
+#define JOYSTICK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// ---------------------------------------------------------------------
+// Seleção das opções pelo eixo X do joystick
+//
+// Cada movimento para além dos limiares avança ou recua uma opção, no
+// máximo uma vez a cada JOYSTICK_MOVE_US. O tempo vem do chamador: na
+// placa é time_us_64() ou o instante gravado da amostra (inc/input_record.h),
+// no PC é o tempo da gravação em tools/replay_host.c.
+//
+// Gravando, a placa guarda a leitura crua sempre que a zona (joystick_zone)
+// muda e a cada movimento. Como joystick_select só muda de estado quando
+// move, reavaliar exatamente essas amostras reproduz as mesmas decisões.
+// ---------------------------------------------------------------------
+
+#define JOYSTICK_THRESHOLD_UP    1000
+#define JOYSTICK_THRESHOLD_DOWN  2100
+#define JOYSTICK_MOVE_US         600000   // 600 ms entre movimentos
+
+typedef enum {
+  JOYSTICK_CENTER = 0,
+  JOYSTICK_UP,        // raw_x < JOYSTICK_THRESHOLD_UP: avança
+  JOYSTICK_DOWN,      // raw_x > JOYSTICK_THRESHOLD_DOWN: recua
+} joystick_zone_t;
+
+typedef struct {
+  bool moved;
+  uint64_t last_move_us;
+} joystick_gate_t;
+
+void joystick_gate_reset(joystick_gate_t *g);
+joystick_zone_t joystick_zone(uint16_t raw_x);
+
+// Devolve a nova opção (0..count-1) ou -1 se a seleção não mudou
+int joystick_select(joystick_gate_t *g, uint64_t now_us, uint16_t raw_x, int selected, int count);
+
+#endif
@@ -0,0 +1,129 @@
+#include "hardware/dma.h"
+#include "ws2812.pio.h"
+#include "led_panels.h"
+
+// 24 bits a 800 kHz por LED, mais o reset (>= 280 us nos WS2812B atuais)
+#define LED_US_PER_LED        30
+#define LED_RESET_US          300
+
+static struct {
+  PIO pio;
+  const led_panel_t *panels;
+  uint8_t count;
+  const uint32_t *frame;
+  uint32_t *tx;
+  uint16_t total;
+  uint16_t first[LED_PANELS_MAX];   // primeiro LED de cada painel no framebuffer
+  int dma[LED_PANELS_MAX];
+  uint32_t dma_mask;
+  uint16_t width, height;
+  uint32_t frame_us;
+  absolute_time_t ready_at;         // fim do quadro anterior (latch incluído)
+} leds;
+
+uint16_t led_panels_init(PIO pio, const led_panel_t *panels, uint8_t count,
+                         const uint32_t *frame, uint32_t *tx, uint16_t n_leds) {
+  if (count == 0 || count > LED_PANELS_MAX)
+    return 0;
+
+  leds.pio = pio;
+  leds.panels = panels;
+  leds.count = count;
+  leds.frame = frame;
+  leds.tx = tx;
+  leds.total = 0;
+  leds.dma_mask = 0;
+  leds.width = leds.height = 0;
+  uint16_t longest = 0;
+
+  uint offset = pio_add_program(pio, &ws2812_program);
+  for (uint8_t p = 0; p < count; ++p) {
+    const led_panel_t *panel = &panels[p];
+    uint16_t n = panel->width * panel->height;
+    if (leds.total + n > n_leds)
+      return 0;
+
+    int sm = pio_claim_unused_sm(pio, false);
+    int ch = dma_claim_unused_channel(false);
+    if (sm < 0 || ch < 0)
+      return 0;
+    ws2812_program_init(pio, sm, offset, panel->pin, 800000, false);
+
+    dma_channel_config c = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(ch, &c, &pio->txf[sm], &tx[leds.total], n, false);
+
+    leds.first[p] = leds.total;
+    leds.dma[p] = ch;
+    leds.dma_mask |= 1u << ch;
+    leds.total += n;
+    if (n > longest)
+      longest = n;
+    if (panel->x + panel->width > leds.width)
+      leds.width = panel->x + panel->width;
+    if (panel->y + panel->height > leds.height)
+      leds.height = panel->y + panel->height;
+  }
+
+  leds.frame_us = longest * LED_US_PER_LED + LED_RESET_US;
+  leds.ready_at = get_absolute_time();
+  return leds.total;
+}
+
+// (x, y) da tela lógica -> posição no framebuffer
+int led_panels_index(uint16_t x, uint16_t y) {
+  for (uint8_t p = 0; p < leds.count; ++p) {
+    const led_panel_t *panel = &leds.panels[p];
+    if (x < panel->x || y < panel->y || x >= panel->x + panel->width || y >= panel->y + panel->height)
+      continue;
+
+    uint8_t l = panel->layout;
+    uint16_t col = x - panel->x, row = y - panel->y;
+    if (l & LED_LAYOUT_RIGHT)
+      col = panel->width - 1 - col;
+    if (l & LED_LAYOUT_BOTTOM)
+      row = panel->height - 1 - row;
+
+    // "major": linha (ou coluna) ao longo da fita; "minor": posição dentro dela
+    uint16_t major = (l & LED_LAYOUT_COLUMNS) ? col : row;
+    uint16_t minor = (l & LED_LAYOUT_COLUMNS) ? row : col;
+    uint16_t run = (l & LED_LAYOUT_COLUMNS) ? panel->height : panel->width;
+    if ((l & LED_LAYOUT_SERPENTINE) && (major & 1))
+      minor = run - 1 - minor;
+    return leds.first[p] + major * run + minor;
+  }
+  return -1;
+}
+
+uint16_t led_panels_width(void) {
+  return leds.width;
+}
+
+uint16_t led_panels_height(void) {
+  return leds.height;
+}
+
+bool led_panels_busy(void) {
+  return !time_reached(leds.ready_at);
+}
+
+// Copia o framebuffer e dispara todos os painéis de uma vez. Só espera
+// se o quadro anterior ainda não terminou (inclusive o latch), por isso é
+// chamada só do loop principal; callbacks do lwIP marcam o quadro como sujo.
+void __not_in_flash_func(led_panels_show)(void) {
+  busy_wait_until(leds.ready_at);
+
+  for (uint16_t i = 0; i < leds.total; ++i)
+    leds.tx[i] = leds.frame[i] << 8;
+
+  for (uint8_t p = 0; p < leds.count; ++p) {
+    const led_panel_t *panel = &leds.panels[p];
+    dma_channel_set_read_addr(leds.dma[p], &leds.tx[leds.first[p]], false);
+    dma_channel_set_trans_count(leds.dma[p], panel->width * panel->height, false);
+  }
+  dma_start_channel_mask(leds.dma_mask);
+  leds.ready_at = make_timeout_time_us(leds.frame_us);
+}
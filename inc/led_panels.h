@@ -0,0 +1,46 @@
+#ifndef LED_PANELS_H
+#define LED_PANELS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+// ---------------------------------------------------------------------
+// Vários painéis WS2812 em paralelo.
+//
+// Cada painel tem seu pino, sua state machine (programa ws2812) e seu
+// canal de DMA. Todos leem do mesmo framebuffer (painel 0 primeiro, na
+// ordem da tabela) e partem juntos com dma_start_channel_mask(): o
+// tempo de um quadro é o do maior painel, não a soma deles.
+// ---------------------------------------------------------------------
+
+#define LED_PANELS_MAX        4     // state machines de um PIO
+
+// Ordem física dos LEDs dentro do painel
+#define LED_LAYOUT_COLUMNS    0x01  // a fita percorre colunas (ex.: painéis 8x32)
+#define LED_LAYOUT_BOTTOM     0x02  // LED 0 na linha de baixo
+#define LED_LAYOUT_RIGHT      0x04  // LED 0 na coluna da direita
+#define LED_LAYOUT_SERPENTINE 0x08  // o sentido alterna a cada linha/coluna
+// Matriz 5x5 da BitDogLab: serpentina por linhas a partir do canto inferior direito
+#define LED_LAYOUT_BITDOGLAB  (LED_LAYOUT_BOTTOM | LED_LAYOUT_RIGHT | LED_LAYOUT_SERPENTINE)
+
+typedef struct {
+  uint8_t pin;
+  uint8_t width, height;
+  uint8_t layout;           // LED_LAYOUT_*
+  uint16_t x, y;            // canto superior esquerdo na tela lógica
+} led_panel_t;
+
+// "frame" e "tx" têm "n_leds" posições; "tx" guarda as palavras já alinhadas
+// para o PIO (cor << 8) enquanto o DMA envia. Retorna o total de LEDs da
+// tabela, ou 0 se não couber ou faltar state machine/DMA.
+uint16_t led_panels_init(PIO pio, const led_panel_t *panels, uint8_t count,
+                         const uint32_t *frame, uint32_t *tx, uint16_t n_leds);
+int led_panels_index(uint16_t x, uint16_t y);    // -1 fora dos painéis
+uint16_t led_panels_width(void);
+uint16_t led_panels_height(void);
+void led_panels_show(void);
+bool led_panels_busy(void);
+
+#endif
@@ -0,0 +1,211 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/flash.h"
+#include "hardware/flash.h"
+#include "lesson_pack.h"
+
+#define LESSON_FLASH_OFFSET   (PICO_FLASH_SIZE_BYTES - LESSON_FLASH_SIZE)
+#define LESSON_XIP_ADDR       ((const uint8_t *) (XIP_BASE + LESSON_FLASH_OFFSET))
+
+// Fim da imagem na flash (linker script do SDK)
+extern char __flash_binary_end;
+
+static_assert(LESSON_FLASH_SIZE % FLASH_SECTOR_SIZE == 0, "região de aulas deve ser múltipla do setor");
+static_assert(LESSON_QUEUE_SIZE % FLASH_PAGE_SIZE == 0, "fila deve ser múltipla da página");
+static_assert(sizeof(lesson_pack_header_t) == 16, "cabeçalho do pacote deve ter 16 bytes");
+static_assert(sizeof(lesson_index_t) == 16, "índice deve ter 16 bytes");
+static_assert(sizeof(lesson_cell_t) == 8, "cela deve ter 8 bytes");
+
+// Estado da validação do pacote gravado (refeita após cada upload)
+static enum { PACK_UNCHECKED, PACK_VALID, PACK_INVALID } pack_state = PACK_UNCHECKED;
+
+// Estado da gravação. "queued" só é escrito pelo IRQ e "written" só pelo
+// loop principal; a diferença é o que está na fila.
+static struct {
+  volatile bool active;
+  bool failed;           // erro de gravação: o resto é descartado
+  uint32_t expected;
+  volatile uint32_t queued;    // bytes recebidos
+  volatile uint32_t written;   // bytes já tirados da fila
+  uint32_t page_fill;
+  uint8_t page[FLASH_PAGE_SIZE];
+  uint8_t queue[LESSON_QUEUE_SIZE];
+} upload;
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    for (uint8_t k = 0; k < 8; ++k)
+      crc = (crc >> 1) ^ (0xEDB88320u & -(crc & 1));
+  }
+  return ~crc;
+}
+
+static bool pack_validate(void) {
+  const lesson_pack_header_t *hdr = (const lesson_pack_header_t *) LESSON_XIP_ADDR;
+  if (memcmp(hdr->magic, LESSON_MAGIC, 4) != 0 || hdr->version != LESSON_VERSION)
+    return false;
+
+  size_t need = sizeof(*hdr) + hdr->lesson_count * sizeof(lesson_index_t) + hdr->cell_count * sizeof(lesson_cell_t);
+  if (hdr->total_size != need || need > LESSON_FLASH_SIZE)
+    return false;
+
+  const lesson_index_t *idx = (const lesson_index_t *) (LESSON_XIP_ADDR + sizeof(*hdr));
+  for (uint8_t i = 0; i < hdr->lesson_count; ++i)
+    if ((uint32_t) idx[i].first_cell + idx[i].cell_count > hdr->cell_count)
+      return false;
+
+  return crc32_update(0, LESSON_XIP_ADDR + sizeof(*hdr), need - sizeof(*hdr)) == hdr->crc32;
+}
+
+const lesson_pack_header_t *lesson_pack_get(void) {
+  if (upload.active)
+    return NULL;
+  if (pack_state == PACK_UNCHECKED)
+    pack_state = pack_validate() ? PACK_VALID : PACK_INVALID;
+  return pack_state == PACK_VALID ? (const lesson_pack_header_t *) LESSON_XIP_ADDR : NULL;
+}
+
+const lesson_index_t *lesson_pack_lesson(uint8_t n) {
+  const lesson_pack_header_t *hdr = lesson_pack_get();
+  if (hdr == NULL || n >= hdr->lesson_count)
+    return NULL;
+  return (const lesson_index_t *) (LESSON_XIP_ADDR + sizeof(*hdr)) + n;
+}
+
+const lesson_cell_t *lesson_pack_cells(const lesson_index_t *lesson) {
+  const lesson_pack_header_t *hdr = lesson_pack_get();
+  if (hdr == NULL || lesson == NULL)
+    return NULL;
+  const lesson_cell_t *cells = (const lesson_cell_t *) (LESSON_XIP_ADDR + sizeof(*hdr) +
+                                                        hdr->lesson_count * sizeof(lesson_index_t));
+  return cells + lesson->first_cell;
+}
+
+// ---------------------------------------------------------------------
+// Gravação na flash
+// ---------------------------------------------------------------------
+typedef struct {
+  uint32_t offset;
+  const uint8_t *data;
+} flash_op_t;
+
+static void do_erase(void *param) {
+  flash_op_t *op = (flash_op_t *) param;
+  flash_range_erase(op->offset, FLASH_SECTOR_SIZE);
+}
+
+static void do_program(void *param) {
+  flash_op_t *op = (flash_op_t *) param;
+  flash_range_program(op->offset, op->data, FLASH_PAGE_SIZE);
+}
+
+// Grava a página acumulada, apagando o setor quando ela é a primeira dele
+static bool flush_page(void) {
+  uint32_t page_offset = LESSON_FLASH_OFFSET + upload.written - upload.page_fill;
+  flash_op_t op = { page_offset, upload.page };
+
+  if (upload.page_fill < FLASH_PAGE_SIZE)
+    memset(upload.page + upload.page_fill, 0xFF, FLASH_PAGE_SIZE - upload.page_fill);
+
+  if ((page_offset % FLASH_SECTOR_SIZE) == 0) {
+    flash_op_t erase = { page_offset, NULL };
+    if (flash_safe_execute(do_erase, &erase, UINT32_MAX) != PICO_OK)
+      return false;
+  }
+  if (flash_safe_execute(do_program, &op, UINT32_MAX) != PICO_OK)
+    return false;
+
+  upload.page_fill = 0;
+  return true;
+}
+
+bool lesson_upload_begin(uint32_t content_len) {
+  if (upload.active || content_len < sizeof(lesson_pack_header_t) || content_len > LESSON_FLASH_SIZE)
+    return false;
+  // Nunca apaga o próprio programa (mem_budget.py --flash-reserve já
+  // checa no build; isto cobre um .uf2 gravado com outra configuração)
+  if ((uintptr_t) &__flash_binary_end > XIP_BASE + LESSON_FLASH_OFFSET)
+    return false;
+  upload.failed = false;
+  upload.expected = content_len;
+  upload.queued = 0;
+  upload.written = 0;
+  upload.page_fill = 0;
+  pack_state = PACK_INVALID;
+  __compiler_memory_barrier();
+  upload.active = true;
+  return true;
+}
+
+bool lesson_upload_queue(const uint8_t *data, size_t len) {
+  if (!upload.active)
+    return false;
+  uint32_t queued = upload.queued;
+  if (queued + len > upload.expected || queued + len - upload.written > LESSON_QUEUE_SIZE)
+    return false;
+  while (len) {
+    size_t at = queued % LESSON_QUEUE_SIZE;
+    size_t n = LESSON_QUEUE_SIZE - at;
+    if (n > len)
+      n = len;
+    memcpy(upload.queue + at, data, n);
+    queued += n;
+    data += n;
+    len -= n;
+  }
+  // Os dados precisam estar na fila antes do contador avançar
+  __compiler_memory_barrier();
+  upload.queued = queued;
+  return true;
+}
+
+size_t lesson_upload_service(void) {
+  if (!upload.active)
+    return 0;
+  uint32_t start = upload.written;
+  uint32_t queued = upload.queued;
+  __compiler_memory_barrier();
+
+  while (upload.written < queued) {
+    size_t at = upload.written % LESSON_QUEUE_SIZE;
+    size_t n = FLASH_PAGE_SIZE - upload.page_fill;
+    if (n > queued - upload.written)
+      n = queued - upload.written;
+    memcpy(upload.page + upload.page_fill, upload.queue + at, n);
+    upload.page_fill += n;
+    upload.written += n;
+
+    if (upload.page_fill == FLASH_PAGE_SIZE) {
+      if (!upload.failed && !flush_page())
+        upload.failed = true;
+      upload.page_fill = 0;
+    }
+  }
+  return upload.written - start;
+}
+
+bool lesson_upload_busy(void) {
+  return upload.active;
+}
+
+bool lesson_upload_complete(void) {
+  return upload.active && upload.written == upload.expected;
+}
+
+bool lesson_upload_finish(void) {
+  if (!upload.active)
+    return false;
+  bool ok = !upload.failed && upload.written == upload.expected;
+  if (ok && upload.page_fill)
+    ok = flush_page();
+  upload.active = false;
+  pack_state = ok && pack_validate() ? PACK_VALID : PACK_INVALID;
+  return pack_state == PACK_VALID;
+}
+
+void lesson_upload_abort(void) {
+  upload.active = false;
+  pack_state = PACK_INVALID;
+}
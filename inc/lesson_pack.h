@@ -0,0 +1,83 @@
+#ifndef LESSON_PACK_H
+#define LESSON_PACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ---------------------------------------------------------------------
+// Pacotes de aula binários
+//
+// Layout (little endian), gerado por tools/lesson_compiler.py:
+//   lesson_pack_header_t
+//   lesson_index_t  [lesson_count]
+//   lesson_cell_t   [cell_count]
+//
+// O pacote é gravado por HTTP POST numa região reservada no fim da
+// flash e usado direto pelo XIP: as celas nunca são copiadas para a RAM.
+//
+// Os hooks de POST rodam no IRQ do lwIP e só copiam os dados para uma
+// fila em RAM; o apagamento e a gravação da flash ficam no loop principal
+// (lesson_upload_service), que devolve a janela TCP conforme consome.
+// ---------------------------------------------------------------------
+
+#define LESSON_MAGIC          "BBLP"
+#define LESSON_VERSION        1
+#define LESSON_NAME_LEN       12
+
+// Região reservada no fim da flash (múltiplo do setor de 4 KB). O CMake
+// passa o mesmo valor para tools/mem_budget.py, que falha o build se o
+// binário invadir essa região.
+#ifndef LESSON_FLASH_SIZE
+#define LESSON_FLASH_SIZE     (64 * 1024)
+#endif
+
+// Fila entre o IRQ do lwIP e o loop principal: precisa comportar uma
+// janela TCP inteira (checado em projeto_final.c)
+#define LESSON_QUEUE_SIZE     (12 * 1024)
+
+// Flags de cada cela
+#define LESSON_CELL_SHUFFLE   0x01   // ignora "options" e sorteia as alternativas
+#define LESSON_CELL_AUTO_NEXT 0x02   // avança sozinho após o feedback
+
+typedef struct __attribute__((packed)) {
+  char magic[4];
+  uint8_t version;
+  uint8_t lesson_count;
+  uint16_t cell_count;
+  uint32_t total_size;   // tamanho do pacote inteiro, com cabeçalho
+  uint32_t crc32;        // CRC-32 (zlib) de tudo que vem depois do cabeçalho
+} lesson_pack_header_t;
+
+typedef struct __attribute__((packed)) {
+  char name[LESSON_NAME_LEN];   // sem terminador se ocupar os 12 bytes
+  uint16_t first_cell;
+  uint16_t cell_count;
+} lesson_index_t;
+
+typedef struct __attribute__((packed)) {
+  char letter;           // cela exibida na matriz
+  char answer;           // resposta esperada
+  char options[3];       // alternativas no OLED
+  uint8_t flags;
+  uint16_t time_ms;      // tempo máximo de resposta (0 = sem limite)
+} lesson_cell_t;
+
+// Leitura (ponteiros para a flash, via XIP)
+const lesson_pack_header_t *lesson_pack_get(void);
+const lesson_index_t *lesson_pack_lesson(uint8_t n);
+const lesson_cell_t *lesson_pack_cells(const lesson_index_t *lesson);
+
+// Recepção (hooks de POST do httpd, no IRQ do lwIP): só copia para a fila
+bool lesson_upload_begin(uint32_t content_len);
+bool lesson_upload_queue(const uint8_t *data, size_t len);
+
+// Gravação (loop principal): apaga/grava o que estiver na fila e devolve
+// quantos bytes foram consumidos
+size_t lesson_upload_service(void);
+bool lesson_upload_busy(void);
+bool lesson_upload_complete(void);
+bool lesson_upload_finish(void);
+void lesson_upload_abort(void);
+
+#endif
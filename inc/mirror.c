@@ -0,0 +1,147 @@
+#include <string.h>
+#include "mirror.h"
+
+void mirror_init(mirror_t *m) {
+  m->seq = 0;
+  m->newest = 0;
+  for (uint8_t i = 0; i < MIRROR_REFS; ++i)
+    m->refs[i].seq = 0;
+}
+
+static uint32_t fnv1a(uint32_t h, const uint8_t *data, size_t len) {
+  while (len--) {
+    h ^= *data++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static const mirror_ref_t *find_ref(const mirror_t *m, uint32_t seq) {
+  for (uint8_t i = 0; seq != 0 && i < MIRROR_REFS; ++i)
+    if (m->refs[i].seq == seq)
+      return &m->refs[i];
+  return NULL;
+}
+
+// Guarda o quadro como o mais recente, no lugar do mais antigo que não
+// seja a base da resposta em andamento
+static void push_ref(mirror_t *m, const mirror_ref_t *base, const mirror_frame_t *frame, const uint8_t *leds) {
+  mirror_ref_t *slot = NULL;
+  for (uint8_t i = 0; i < MIRROR_REFS; ++i) {
+    mirror_ref_t *r = &m->refs[i];
+    if (r != base && (slot == NULL || r->seq < slot->seq))
+      slot = r;
+  }
+  if (++m->seq == 0)
+    m->seq = 1;
+  slot->seq = m->seq;
+  memcpy(slot->oled, frame->oled, frame->oled_len);
+  memcpy(slot->leds, leds, frame->n_leds * 3u);
+  m->newest = (uint8_t) (slot - m->refs);
+}
+
+// RLE de (cur XOR ref); ref == NULL vira quadro-chave. Retorna 0 se não couber.
+static size_t rle_xor(const uint8_t *cur, const uint8_t *ref, size_t len, uint8_t *out, size_t max) {
+  size_t o = 0, i = 0;
+#define AT(k) ((uint8_t) (cur[k] ^ (ref ? ref[k] : 0)))
+
+  while (i < len) {
+    // Repetição de pelo menos 3 bytes iguais
+    uint8_t v = AT(i);
+    size_t run = 1;
+    while (i + run < len && run < 128 && AT(i + run) == v)
+      run++;
+    if (run >= 3) {
+      if (o + 2 > max) return 0;
+      out[o++] = (uint8_t) (0x80 | (run - 1));
+      out[o++] = v;
+      i += run;
+      continue;
+    }
+
+    // Literais até a próxima repetição
+    size_t start = i, lit = 0;
+    while (i < len && lit < 128) {
+      if (i + 2 < len && AT(i) == AT(i + 1) && AT(i) == AT(i + 2))
+        break;
+      i++;
+      lit++;
+    }
+    if (o + 1 + lit > max) return 0;
+    out[o++] = (uint8_t) (lit - 1);
+    for (size_t k = 0; k < lit; ++k)
+      out[o++] = AT(start + k);
+  }
+#undef AT
+  return o;
+}
+
+static size_t put_section(const uint8_t *cur, const uint8_t *ref, size_t len, uint8_t *out, size_t max) {
+  if (max < 2) return 0;
+  size_t n = len ? rle_xor(cur, ref, len, out + 2, max - 2) : 0;
+  if (len && n == 0) return 0;
+  out[0] = (uint8_t) n;
+  out[1] = (uint8_t) (n >> 8);
+  return n + 2;
+}
+
+size_t mirror_encode(mirror_t *m, const mirror_frame_t *frame, uint32_t since, uint8_t *out, size_t max) {
+  if (max < MIRROR_HEADER_SIZE + 4 || frame->oled_len > MIRROR_MAX_OLED || frame->n_leds > MIRROR_MAX_LEDS)
+    return 0;
+
+  // Cores compactadas em 3 bytes por LED, byte mais alto primeiro
+  uint8_t leds[MIRROR_MAX_LEDS * 3];
+  size_t leds_len = frame->n_leds * 3u;
+  for (uint8_t i = 0; i < frame->n_leds; ++i) {
+    leds[i * 3] = (uint8_t) (frame->leds[i] >> 16);
+    leds[i * 3 + 1] = (uint8_t) (frame->leds[i] >> 8);
+    leds[i * 3 + 2] = (uint8_t) frame->leds[i];
+  }
+
+  // Novo "seq" só quando o conteúdo mudou desde o último quadro servido
+  const mirror_ref_t *base = find_ref(m, since);
+  const mirror_ref_t *cur = &m->refs[m->newest];
+  if (cur->seq == 0 || memcmp(cur->oled, frame->oled, frame->oled_len) != 0 ||
+      memcmp(cur->leds, leds, leds_len) != 0) {
+    push_ref(m, base, frame, leds);
+    cur = &m->refs[m->newest];
+  }
+
+  uint8_t flags = frame->page_major ? MIRROR_FLAG_PAGE_MAJOR : 0;
+  if (base == NULL)
+    flags |= MIRROR_FLAG_KEY;
+  else if (base == cur)
+    flags |= MIRROR_FLAG_UNCHANGED;
+
+  uint32_t crc = fnv1a(fnv1a(2166136261u, cur->oled, frame->oled_len), cur->leds, leds_len);
+
+  out[0] = 'B';
+  out[1] = 'M';
+  out[2] = MIRROR_VERSION;
+  out[3] = flags;
+  out[4] = (uint8_t) cur->seq;
+  out[5] = (uint8_t) (cur->seq >> 8);
+  out[6] = (uint8_t) (cur->seq >> 16);
+  out[7] = (uint8_t) (cur->seq >> 24);
+  out[8] = frame->width;
+  out[9] = frame->height;
+  out[10] = frame->n_leds;
+  out[11] = 0;
+  out[12] = (uint8_t) frame->oled_len;
+  out[13] = (uint8_t) (frame->oled_len >> 8);
+  out[14] = (uint8_t) crc;
+  out[15] = (uint8_t) (crc >> 8);
+  out[16] = (uint8_t) (crc >> 16);
+  out[17] = (uint8_t) (crc >> 24);
+  size_t o = MIRROR_HEADER_SIZE;
+
+  if (flags & MIRROR_FLAG_UNCHANGED)
+    return o;
+
+  size_t n = put_section(cur->oled, base ? base->oled : NULL, frame->oled_len, out + o, max - o);
+  if (n == 0) return 0;
+  o += n;
+  n = put_section(cur->leds, base ? base->leds : NULL, leds_len, out + o, max - o);
+  if (n == 0) return 0;
+  return o + n;
+}
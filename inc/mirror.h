@@ -0,0 +1,63 @@
+#ifndef MIRROR_H
+#define MIRROR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ---------------------------------------------------------------------
+// Espelho remoto do OLED e da matriz de LEDs (/mirror.cgi?since=N)
+//
+// Resposta (little endian):
+//   'B' 'M' versão flags  seq(u32)  largura altura  n_leds  reservado
+//   u16 tamanho do OLED  u32 FNV-1a do quadro completo (OLED e depois LEDs)
+//   u16 tamanho + RLE do framebuffer do OLED (XOR com o quadro de referência)
+//   u16 tamanho + RLE das cores dos LEDs, 3 bytes cada (XOR com a referência)
+//
+// O "seq" é do módulo: só muda quando o conteúdo muda. Os últimos
+// MIRROR_REFS quadros servidos ficam guardados; quem informa um desses
+// "seq" recebe só a diferença (quase tudo zero, comprime para poucos
+// bytes), senão recebe um quadro-chave. Assim vários painéis consultando
+// ao mesmo tempo não forçam quadros-chave uns aos outros. O cliente
+// confere o FNV-1a depois de aplicar a diferença e, se não bater, pede
+// um quadro-chave (since=0).
+//
+// RLE: byte de controle c; c & 0x80 -> (c & 0x7F) + 1 repetições do
+// próximo byte; senão c + 1 bytes literais em seguida.
+// ---------------------------------------------------------------------
+
+#define MIRROR_VERSION        2
+#define MIRROR_HEADER_SIZE    18
+#define MIRROR_MAX_OLED       1024
+#define MIRROR_MAX_LEDS       25
+#define MIRROR_REFS           4
+
+#define MIRROR_FLAG_KEY       0x01   // quadro completo (XOR com zeros)
+#define MIRROR_FLAG_UNCHANGED 0x02   // nada mudou desde "since": sem dados
+#define MIRROR_FLAG_PAGE_MAJOR 0x04  // OLED em páginas (índice = página * largura + x)
+
+typedef struct {
+  uint32_t seq;           // 0 = vazio
+  uint8_t oled[MIRROR_MAX_OLED];
+  uint8_t leds[MIRROR_MAX_LEDS * 3];
+} mirror_ref_t;
+
+typedef struct {
+  uint32_t seq;           // último "seq" dado
+  uint8_t newest;         // índice do quadro mais recente em refs
+  mirror_ref_t refs[MIRROR_REFS];
+} mirror_t;
+
+typedef struct {
+  const uint8_t *oled;    // framebuffer sem o byte de controle
+  uint16_t oled_len;
+  uint8_t width, height;
+  bool page_major;
+  const uint32_t *leds;   // cor de 24 bits como enviada ao WS2812
+  uint8_t n_leds;
+} mirror_frame_t;
+
+void mirror_init(mirror_t *m);
+size_t mirror_encode(mirror_t *m, const mirror_frame_t *frame, uint32_t since, uint8_t *out, size_t max);
+
+#endif
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include "quiz.h"
+
+void quiz_start(quiz_t *q, char letter, const char options[3], uint64_t now_us) {
+  q->open = true;
+  q->round++;
+  q->letter = (char) toupper((unsigned char) letter);
+  memcpy(q->options, options, 3);
+  q->start_us = now_us;
+  q->count = 0;
+  q->correct = 0;
+}
+
+void quiz_close(quiz_t *q) {
+  q->open = false;
+}
+
+quiz_result_t quiz_answer(quiz_t *q, const char *id, char answer, uint64_t now_us) {
+  if (!q->open)
+    return QUIZ_CLOSED;
+  if (id == NULL || id[0] == '\0' || strlen(id) >= QUIZ_ID_LEN || !isalpha((unsigned char) answer))
+    return QUIZ_INVALID;
+  // O id vai para o JSON: só caracteres que não precisam de escape
+  for (const char *c = id; *c; ++c)
+    if (!isalnum((unsigned char) *c) && *c != '-' && *c != '_')
+      return QUIZ_INVALID;
+
+  for (uint8_t i = 0; i < q->count; ++i)
+    if (strcmp(q->entries[i].id, id) == 0)
+      return QUIZ_DUPLICATE;
+  if (q->count >= QUIZ_MAX_CLIENTS)
+    return QUIZ_FULL;
+
+  // A entrada é preenchida antes de contar: o loop principal lê sem trava
+  quiz_entry_t *e = &q->entries[q->count];
+  strcpy(e->id, id);
+  e->answer = (char) toupper((unsigned char) answer);
+  e->correct = e->answer == q->letter;
+  e->time_ms = (uint32_t) ((now_us - q->start_us) / 1000);
+  q->count++;
+  if (e->correct)
+    q->correct++;
+  return QUIZ_ACCEPTED;
+}
+
+const quiz_entry_t *quiz_ranked(const quiz_t *q, uint8_t n) {
+  for (uint8_t i = 0; i < q->count; ++i) {
+    if (q->entries[i].correct && n-- == 0)
+      return &q->entries[i];
+  }
+  return NULL;
+}
+
+size_t quiz_render_json(const quiz_t *q, char *out, size_t max) {
+  size_t n = snprintf(out, max, "{\"open\":%s,\"round\":%u,\"options\":\"%.3s\",\"answers\":%u,\"correct\":%u",
+                      q->open ? "true" : "false", q->round, q->options, q->count, q->correct);
+  if (!q->open && q->round > 0 && n < max) {
+    n += snprintf(out + n, max - n, ",\"letter\":\"%c\",\"ranking\":[", q->letter);
+    const quiz_entry_t *e;
+    for (uint8_t i = 0; n < max && (e = quiz_ranked(q, i)) != NULL; ++i)
+      n += snprintf(out + n, max - n, "%s{\"id\":\"%s\",\"ms\":%lu}", i ? "," : "", e->id, (unsigned long) e->time_ms);
+    if (n < max)
+      n += snprintf(out + n, max - n, "],\"wrong\":[");
+    bool first = true;
+    for (uint8_t i = 0; i < q->count && n < max; ++i) {
+      e = &q->entries[i];
+      if (e->correct)
+        continue;
+      n += snprintf(out + n, max - n, "%s{\"id\":\"%s\",\"r\":\"%c\",\"ms\":%lu}", first ? "" : ",",
+                    e->id, e->answer, (unsigned long) e->time_ms);
+      first = false;
+    }
+    if (n < max)
+      n += snprintf(out + n, max - n, "]");
+  }
+  if (n < max)
+    n += snprintf(out + n, max - n, "}");
+  return n < max ? n : max;
+}
@@ -0,0 +1,57 @@
+#ifndef QUIZ_H
+#define QUIZ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// ---------------------------------------------------------------------
+// Quiz remoto: a placa mostra uma cela e vários celulares respondem por
+// /quiz.cgi?id=<nome>&r=<letra>.
+//
+// Cada resposta recebe o carimbo de chegada (tempo desde o início da
+// rodada). Como as respostas são guardadas na ordem de chegada, o
+// ranking dos acertos já está ordenado por tempo, sem ordenação.
+// Só a primeira resposta de cada id vale.
+// ---------------------------------------------------------------------
+
+#define QUIZ_MAX_CLIENTS  32
+#define QUIZ_ID_LEN       16
+// Pior caso de quiz_render_json: ~110 bytes fixos + até 49 por resposta
+#define QUIZ_JSON_MAX     (128 + QUIZ_MAX_CLIENTS * 56)
+
+typedef enum {
+  QUIZ_ACCEPTED = 0,
+  QUIZ_DUPLICATE,
+  QUIZ_CLOSED,
+  QUIZ_FULL,
+  QUIZ_INVALID
+} quiz_result_t;
+
+typedef struct {
+  char id[QUIZ_ID_LEN];
+  char answer;
+  bool correct;
+  uint32_t time_ms;
+} quiz_entry_t;
+
+typedef struct {
+  bool open;
+  uint16_t round;
+  char letter;
+  char options[3];
+  uint64_t start_us;
+  uint8_t count;
+  uint8_t correct;
+  quiz_entry_t entries[QUIZ_MAX_CLIENTS];
+} quiz_t;
+
+void quiz_start(quiz_t *q, char letter, const char options[3], uint64_t now_us);
+void quiz_close(quiz_t *q);
+quiz_result_t quiz_answer(quiz_t *q, const char *id, char answer, uint64_t now_us);
+// n-ésimo acerto (0 = mais rápido), ou NULL
+const quiz_entry_t *quiz_ranked(const quiz_t *q, uint8_t n);
+// A letra e o ranking só aparecem depois de encerrada a rodada
+size_t quiz_render_json(const quiz_t *q, char *out, size_t max);
+
+#endif
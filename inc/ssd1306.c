@@ -1,44 +1,74 @@
+#include <string.h>
 #include "ssd1306.h"
-#include "font.h"
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
-  ssd->width = width;
-  ssd->height = height;
-  ssd->pages = height / 8U;
+// COM pins: alternado para 64 linhas, sequencial para 32
+#define SSD1306_COM_PINS (HEIGHT == 64 ? 0x12 : 0x02)
+
+// Sequência de init de cada controlador (só a do painel escolhido é compilada)
+static const uint8_t ssd1306_init_table[] = {
+  SET_DISP | 0x00,
+#if SSD1306_CONTROLLER == SSD1306_CTRL_SSD1306
+  SET_MEM_ADDR, 0x00,                  // horizontal: framebuffer inteiro numa escrita
+  SET_DISP_START_LINE | 0x00,
+  SET_SEG_REMAP | 0x01,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_COM_OUT_DIR | 0x08,
+  SET_DISP_OFFSET, 0x00,
+  SET_COM_PIN_CFG, SSD1306_COM_PINS,
+  SET_DISP_CLK_DIV, 0x80,
+  SET_PRECHARGE, 0xF1,
+  SET_VCOM_DESEL, 0x30,
+  SET_CONTRAST, 0xFF,
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+  SET_CHARGE_PUMP, 0x14,
+#elif SSD1306_CONTROLLER == SSD1306_CTRL_SSD1309
+  SET_MEM_ADDR, 0x00,
+  SET_DISP_START_LINE | 0x00,
+  SET_SEG_REMAP | 0x01,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_COM_OUT_DIR | 0x08,
+  SET_DISP_OFFSET, 0x00,
+  SET_COM_PIN_CFG, SSD1306_COM_PINS,
+  SET_DISP_CLK_DIV, 0xA0,
+  SET_PRECHARGE, 0xD3,
+  SET_VCOM_DESEL, 0x20,
+  SET_CONTRAST, 0x6F,
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+#elif SSD1306_CONTROLLER == SSD1306_CTRL_SH1106
+  SET_DISP_CLK_DIV, 0x80,
+  SET_MUX_RATIO, HEIGHT - 1,
+  SET_DISP_OFFSET, 0x00,
+  SET_DISP_START_LINE | 0x00,
+  0xAD, 0x8B,                          // conversor DC-DC interno ligado
+  SET_SEG_REMAP | 0x01,
+  SET_COM_OUT_DIR | 0x08,
+  SET_COM_PIN_CFG, SSD1306_COM_PINS,
+  SET_CONTRAST, 0xFF,
+  SET_PRECHARGE, 0x1F,
+  SET_VCOM_DESEL, 0x40,
+  0x32,                                // tensão da bomba: 8 V
+  SET_ENTIRE_ON,
+  SET_NORM_INV,
+#else
+#error "SSD1306_CONTROLLER desconhecido"
+#endif
+  SET_DISP | 0x01,
+};
+
+void ssd1306_init(ssd1306_t *ssd, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
   ssd->address = address;
   ssd->i2c_port = i2c;
-  ssd->bufsize = ssd->pages * ssd->width + 1;
-  ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+  ssd->external_vcc = external_vcc;
+  memset(ssd->ram_buffer, 0, sizeof(ssd->ram_buffer));
   ssd->ram_buffer[0] = 0x40;
   ssd->port_buffer[0] = 0x80;
 }
 
 void ssd1306_config(ssd1306_t *ssd) {
-  ssd1306_command(ssd, SET_DISP | 0x00);
-  ssd1306_command(ssd, SET_MEM_ADDR);
-  ssd1306_command(ssd, 0x01);
-  ssd1306_command(ssd, SET_DISP_START_LINE | 0x00);
-  ssd1306_command(ssd, SET_SEG_REMAP | 0x01);
-  ssd1306_command(ssd, SET_MUX_RATIO);
-  ssd1306_command(ssd, HEIGHT - 1);
-  ssd1306_command(ssd, SET_COM_OUT_DIR | 0x08);
-  ssd1306_command(ssd, SET_DISP_OFFSET);
-  ssd1306_command(ssd, 0x00);
-  ssd1306_command(ssd, SET_COM_PIN_CFG);
-  ssd1306_command(ssd, 0x12);
-  ssd1306_command(ssd, SET_DISP_CLK_DIV);
-  ssd1306_command(ssd, 0x80);
-  ssd1306_command(ssd, SET_PRECHARGE);
-  ssd1306_command(ssd, 0xF1);
-  ssd1306_command(ssd, SET_VCOM_DESEL);
-  ssd1306_command(ssd, 0x30);
-  ssd1306_command(ssd, SET_CONTRAST);
-  ssd1306_command(ssd, 0xFF);
-  ssd1306_command(ssd, SET_ENTIRE_ON);
-  ssd1306_command(ssd, SET_NORM_INV);
-  ssd1306_command(ssd, SET_CHARGE_PUMP);
-  ssd1306_command(ssd, 0x14);
-  ssd1306_command(ssd, SET_DISP | 0x01);
+  for (size_t i = 0; i < sizeof(ssd1306_init_table); ++i)
+    ssd1306_command(ssd, ssd1306_init_table[i]);
 }
 
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
@@ -52,24 +82,46 @@ void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   );
 }
 
+#if SSD1306_CONTROLLER == SSD1306_CTRL_SH1106
+// SH1106: uma escrita por página. O byte antes de cada página vira o
+// byte de controle (0x40) durante o envio e é restaurado em seguida.
+void ssd1306_send_data(ssd1306_t *ssd) {
+  for (uint8_t page = 0; page < SSD1306_PAGES; ++page) {
+    ssd1306_command(ssd, 0xB0 | page);
+    ssd1306_command(ssd, 0x00 | (SSD1306_COL_OFFSET & 0x0F));
+    ssd1306_command(ssd, 0x10 | (SSD1306_COL_OFFSET >> 4));
+
+    uint8_t *start = &ssd->ram_buffer[page * WIDTH];
+    uint8_t saved = *start;
+    *start = 0x40;
+    i2c_write_blocking(ssd->i2c_port, ssd->address, start, WIDTH + 1, false);
+    *start = saved;
+  }
+}
+#else
 void ssd1306_send_data(ssd1306_t *ssd) {
   ssd1306_command(ssd, SET_COL_ADDR);
   ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->width - 1);
+  ssd1306_command(ssd, WIDTH - 1);
   ssd1306_command(ssd, SET_PAGE_ADDR);
   ssd1306_command(ssd, 0);
-  ssd1306_command(ssd, ssd->pages - 1);
+  ssd1306_command(ssd, SSD1306_PAGES - 1);
   i2c_write_blocking(
     ssd->i2c_port,
     ssd->address,
     ssd->ram_buffer,
-    ssd->bufsize,
+    SSD1306_BUFSIZE,
     false
   );
 }
-
-void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
-  uint16_t index = (y >> 3) + (x << 3) + 1;
+#endif
+
+// Rotinas de desenho chamadas por pixel ficam na SRAM: não disputam o cache
+// da XIP com o cyw43 e o lwIP
+void __not_in_flash_func(ssd1306_pixel)(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
+  if (x >= WIDTH || y >= HEIGHT)
+    return;
+  uint16_t index = (y >> 3) * WIDTH + x + 1;
   uint8_t pixel = (y & 0b111);
   if (value)
     ssd->ram_buffer[index] |= (1 << pixel);
@@ -77,23 +129,17 @@ void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     ssd->ram_buffer[index] &= ~(1 << pixel);
 }
 
-/*
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-  uint8_t byte = value ? 0xFF : 0x00;
-  for (uint8_t i = 1; i < ssd->bufsize; ++i)
-    ssd->ram_buffer[i] = byte;
-}*/
-
-void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    // Itera por todas as posições do display
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
-    }
+void __not_in_flash_func(ssd1306_fill)(ssd1306_t *ssd, bool value) {
+  // Tamanho constante: vira um memset direto no framebuffer
+  memset(&ssd->ram_buffer[1], value ? 0xFF : 0x00, SSD1306_BUFSIZE - 1);
 }
 
-
+// Copia uma tela pré-renderizada (oled_screens.h) para o framebuffer.
+// Fica na RAM e não vai direto da flash para o I2C: o espelho e o que
+// for desenhado por cima continuam vendo o quadro inteiro.
+void __not_in_flash_func(ssd1306_blit)(ssd1306_t *ssd, const uint8_t *frame) {
+  memcpy(&ssd->ram_buffer[1], &frame[1], SSD1306_BUFSIZE - 1);
+}
 
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
   for (uint8_t x = left; x < left + width; ++x) {
@@ -142,7 +188,6 @@ void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1
     }
 }
 
-
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
   for (uint8_t x = x0; x <= x1; ++x)
     ssd1306_pixel(ssd, x, y, value);
@@ -154,32 +199,16 @@ void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value
 }
 
 // Função para desenhar um caractere
-void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
+void __not_in_flash_func(ssd1306_draw_char)(ssd1306_t *ssd, char c, uint8_t x, uint8_t y)
 {
-    uint16_t index = 0;
-
-    if (c >= 'A' && c <= 'Z') {
-        index = (c - 'A' + 11) * 8; // Índice para letras maiúsculas
-    } else if (c >= '0' && c <= '9') {
-        index = (c - '0' + 1) * 8; // Índice para números
-    } else if (c >= 'a' && c <= 'z') {
-        index = (c - 'a' + 37) * 8; // Índice para letras minúsculas
-    } else if (c >= '!' && c <= '/') {
-        index = (c - '!' + 63) * 8; // Índice para caracteres especiais de '!' a '/'
-    } else {
+    const uint8_t *glyph = ssd1306_glyph(c);
+    if (glyph == NULL)
         return; // Caractere não suportado
-    }
 
-    for (uint8_t i = 0; i < 8; ++i) {
-        uint8_t line = font[index + i];
-        for (uint8_t j = 0; j < 8; ++j) {
-            ssd1306_pixel(ssd, x + i, y + j, line & (1 << j));
-        }
-    }
+    // Mesmo resultado do desenho pixel a pixel (conferido por tools/glyph_check.c)
+    ssd1306_glyph_blit(&ssd->ram_buffer[1], WIDTH, SSD1306_PAGES, glyph, x, y);
 }
 
-
-
 // Função para desenhar uma string
 void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
 {
@@ -187,12 +216,12 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y)
   {
     ssd1306_draw_char(ssd, *str++, x, y);
     x += 8;
-    if (x + 8 >= ssd->width)
+    if (x + 8 >= WIDTH)
     {
       x = 0;
       y += 8;
     }
-    if (y + 8 >= ssd->height)
+    if (y + 8 > HEIGHT)
     {
       break;
     }
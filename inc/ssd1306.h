@@ -1,9 +1,44 @@
+#ifndef SSD1306_H
+#define SSD1306_H
+
 #include <stdlib.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "ssd1306_glyph.h"
+
+// Painel escolhido em tempo de compilação (CMake: BITBRAILLE_OLED_*).
+// Geometria e controlador viram constantes: a conta de índice do pixel
+// é resolvida pelo compilador e só a tabela de init do painel entra no binário.
+#define SSD1306_CTRL_SSD1306 0
+#define SSD1306_CTRL_SH1106  1   // RAM de 132 colunas, só endereçamento por página
+#define SSD1306_CTRL_SSD1309 2   // VCC externo, sem charge pump
+
+#ifndef SSD1306_CONTROLLER
+#define SSD1306_CONTROLLER SSD1306_CTRL_SSD1306
+#endif
+#ifndef SSD1306_WIDTH
+#define SSD1306_WIDTH 128
+#endif
+#ifndef SSD1306_HEIGHT
+#define SSD1306_HEIGHT 64
+#endif
 
-#define WIDTH 128
-#define HEIGHT 64
+#if SSD1306_HEIGHT != 32 && SSD1306_HEIGHT != 64
+#error "SSD1306_HEIGHT deve ser 32 ou 64"
+#endif
+#if SSD1306_CONTROLLER == SSD1306_CTRL_SH1106
+#define SSD1306_COL_OFFSET 2     // 128 colunas visíveis centradas nas 132 da RAM
+#else
+#define SSD1306_COL_OFFSET 0
+#endif
+
+#define WIDTH SSD1306_WIDTH
+#define HEIGHT SSD1306_HEIGHT
+#define SSD1306_PAGES (HEIGHT / 8)
+
+// Framebuffer em páginas: byte [1 + página * WIDTH + x], bit (y & 7).
+// O byte 0 é o de controle (0x40) para enviar tudo numa transferência.
+#define SSD1306_BUFSIZE (WIDTH * SSD1306_PAGES + 1)
 
 typedef enum {
   SET_CONTRAST = 0x81,
@@ -26,24 +61,26 @@ typedef enum {
 } ssd1306_command_t;
 
 typedef struct {
-  uint8_t width, height, pages, address;
+  uint8_t address;
   i2c_inst_t *i2c_port;
   bool external_vcc;
-  uint8_t *ram_buffer;
-  size_t bufsize;
+  uint8_t ram_buffer[SSD1306_BUFSIZE];
   uint8_t port_buffer[2];
 } ssd1306_t;
 
-void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+void ssd1306_init(ssd1306_t *ssd, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
 void ssd1306_send_data(ssd1306_t *ssd);
 
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *frame);
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill);
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool value);
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value);
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value);
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y);
-void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
\ No newline at end of file
+void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y);
+
+#endif
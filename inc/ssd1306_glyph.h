@@ -0,0 +1,48 @@
+#ifndef SSD1306_GLYPH_H
+#define SSD1306_GLYPH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Atlas de glifos 8x8 gerado no build a partir de font.h (tools/prerender_screens.py,
+// em oled_assets.c): cada glifo já é um bloco de página, 8 colunas com bit j = linha j.
+// A máscara marca os caracteres que têm glifo. Os dois ficam na SRAM
+// (__not_in_flash), já que ssd1306_draw_char roda da SRAM.
+//
+// Sem dependência do SDK: tools/glyph_check.c usa o mesmo código no PC.
+#define SSD1306_GLYPH_FIRST 0x20
+#define SSD1306_GLYPH_COUNT 96
+extern const uint8_t ssd1306_glyph_atlas[SSD1306_GLYPH_COUNT][8];
+extern const uint32_t ssd1306_glyph_mask[(SSD1306_GLYPH_COUNT + 31) / 32];
+
+// Glifo de c no atlas, ou NULL se o caractere não é suportado
+static inline __attribute__((always_inline)) const uint8_t *ssd1306_glyph(char c) {
+  uint8_t code = (uint8_t) c - SSD1306_GLYPH_FIRST;
+  if (code >= SSD1306_GLYPH_COUNT || !(ssd1306_glyph_mask[code >> 5] & (1u << (code & 31))))
+    return NULL;
+  return ssd1306_glyph_atlas[code];
+}
+
+// Escreve o glifo em (x, y) num framebuffer em páginas ("pages" aponta para
+// a página 0, sem o byte de controle). O glifo cobre no máximo duas páginas:
+// parte de cima deslocada para a página de y, o resto na seguinte. Substitui
+// os 8x8 pixels e corta o que passar da borda, como pixel a pixel.
+static inline __attribute__((always_inline)) void ssd1306_glyph_blit(uint8_t *pages, uint8_t width, uint8_t n_pages,
+                                                                     const uint8_t glyph[8], uint8_t x, uint8_t y) {
+  if (x >= width || (y >> 3) >= n_pages)
+    return;
+
+  uint8_t shift = y & 7;
+  uint8_t *row = &pages[(y >> 3) * width];
+  uint8_t *next = ((y >> 3) + 1 < n_pages) ? row + width : NULL;
+  uint8_t keep = (1u << shift) - 1;
+  uint8_t cols = (width - x) < 8 ? (width - x) : 8;
+
+  for (uint8_t i = 0; i < cols; ++i) {
+    row[x + i] = (row[x + i] & keep) | (uint8_t) (glyph[i] << shift);
+    if (shift && next)
+      next[x + i] = (next[x + i] & ~keep) | (glyph[i] >> (8 - shift));
+  }
+}
+
+#endif
@@ -0,0 +1,51 @@
+#include <string.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "trace.h"
+
+static_assert((TRACE_CAPACITY & (TRACE_CAPACITY - 1)) == 0, "TRACE_CAPACITY deve ser potência de 2");
+
+static trace_record_t trace_buf[TRACE_CAPACITY];
+static volatile uint32_t trace_head = 0;   // total de registros já escritos
+
+// Chamado de IRQs e do loop principal. A seção com interrupções
+// desligadas tem só algumas instruções (bem abaixo de 1 us a 125 MHz),
+// sem spinlock nem espera. Fica na SRAM para não medir cache miss.
+void __time_critical_func(trace_event)(uint8_t id, uint8_t phase, uint16_t arg) {
+  uint32_t irq = save_and_disable_interrupts();
+  trace_record_t *r = &trace_buf[trace_head & (TRACE_CAPACITY - 1)];
+  r->ts_us = time_us_32();
+  r->id = id;
+  r->phase = phase;
+  r->arg = arg;
+  trace_head = trace_head + 1;
+  restore_interrupts(irq);
+}
+
+// Copia cabeçalho + registros (do mais antigo ao mais novo) para "out"
+size_t trace_snapshot(uint8_t *out, size_t max) {
+  if (max < sizeof(trace_header_t))
+    return 0;
+
+  uint32_t irq = save_and_disable_interrupts();
+  uint32_t head = trace_head;
+  uint32_t count = head < TRACE_CAPACITY ? head : TRACE_CAPACITY;
+  uint32_t fit = (max - sizeof(trace_header_t)) / sizeof(trace_record_t);
+  if (count > fit)
+    count = fit;
+
+  trace_header_t hdr;
+  memcpy(hdr.magic, TRACE_MAGIC, 4);
+  hdr.version = TRACE_VERSION;
+  hdr.record_size = sizeof(trace_record_t);
+  hdr.count = (uint16_t) count;
+  hdr.dropped = head - count;
+  memcpy(out, &hdr, sizeof(hdr));
+
+  uint8_t *dst = out + sizeof(hdr);
+  for (uint32_t i = 0; i < count; ++i, dst += sizeof(trace_record_t))
+    memcpy(dst, &trace_buf[(head - count + i) & (TRACE_CAPACITY - 1)], sizeof(trace_record_t));
+  restore_interrupts(irq);
+
+  return sizeof(hdr) + count * sizeof(trace_record_t);
+}
@@ -0,0 +1,82 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ---------------------------------------------------------------------
+// Rastreamento binário de eventos (ring buffer)
+//
+// Cada registro tem 8 bytes: timestamp em us (32 bits), id do evento,
+// fase (início/fim/instantâneo) e um argumento de 16 bits.
+// O buffer é circular: quando enche, os registros mais antigos são
+// sobrescritos. O conteúdo é exportado em /trace.bin e convertido
+// no PC com tools/trace2chrome.py.
+// ---------------------------------------------------------------------
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+// Quantidade de registros (potência de 2)
+#ifndef TRACE_CAPACITY
+#define TRACE_CAPACITY 512
+#endif
+
+#define TRACE_MAGIC   "BBTR"
+#define TRACE_VERSION 1
+
+typedef enum {
+  TRACE_GPIO_IRQ = 1,   // my_gpio_callback (arg = gpio)
+  TRACE_CGI,            // cgi_handler (arg = número de parâmetros)
+  TRACE_OLED_FLUSH,     // envio do framebuffer por I2C
+  TRACE_WS2812_FRAME,   // envio de um quadro para a matriz
+  TRACE_BUZZER,         // buzzer ligado/desligado (arg = slice PWM)
+  TRACE_WIFI,           // mudança de estado do Wi-Fi (arg = trace_wifi_state_t)
+  TRACE_REPLAY,         // reprodução de entradas gravadas (arg = velocidade %)
+  TRACE_INPUT,          // entrada reproduzida (arg = input_type_t)
+} trace_id_t;
+
+typedef enum {
+  TRACE_PH_BEGIN = 'B',
+  TRACE_PH_END = 'E',
+  TRACE_PH_INSTANT = 'i',
+} trace_phase_t;
+
+typedef enum {
+  TRACE_WIFI_INIT = 0,
+  TRACE_WIFI_CONNECTING,
+  TRACE_WIFI_CONNECTED,
+  TRACE_WIFI_FAILED,
+} trace_wifi_state_t;
+
+typedef struct {
+  uint32_t ts_us;
+  uint8_t id;
+  uint8_t phase;
+  uint16_t arg;
+} trace_record_t;
+
+// Cabeçalho do dump binário (seguido de "count" registros, do mais antigo ao mais novo)
+typedef struct {
+  char magic[4];
+  uint8_t version;
+  uint8_t record_size;
+  uint16_t count;
+  uint32_t dropped;     // registros sobrescritos desde o boot
+} trace_header_t;
+
+void trace_event(uint8_t id, uint8_t phase, uint16_t arg);
+size_t trace_snapshot(uint8_t *out, size_t max);
+
+#if TRACE_ENABLED
+#define TRACE_BEGIN(id, arg)   trace_event((id), TRACE_PH_BEGIN, (uint16_t) (arg))
+#define TRACE_END(id, arg)     trace_event((id), TRACE_PH_END, (uint16_t) (arg))
+#define TRACE_INSTANT(id, arg) trace_event((id), TRACE_PH_INSTANT, (uint16_t) (arg))
+#else
+#define TRACE_BEGIN(id, arg)   ((void) 0)
+#define TRACE_END(id, arg)     ((void) 0)
+#define TRACE_INSTANT(id, arg) ((void) 0)
+#endif
+
+#endif
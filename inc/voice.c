@@ -0,0 +1,195 @@
+#include <ctype.h>
+#include "hardware/pwm.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "voice.h"
+
+// Tabelas e decodificação usadas na IRQ do DMA ficam na SRAM
+static const int16_t __not_in_flash("voice_tables") step_table[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+  253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+  1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+  3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+  11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+  32767
+};
+
+static const int8_t __not_in_flash("voice_tables") index_table[16] = {
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// Estado do decodificador
+typedef struct {
+  const uint8_t *data;
+  uint32_t remaining;       // amostras ainda não decodificadas
+  int32_t predictor;
+  int8_t index;
+  bool high_nibble;
+} adpcm_state_t;
+
+static struct {
+  bool ready;
+  volatile bool playing;
+  volatile uint8_t tail_blocks;   // blocos de silêncio restantes até parar
+  uint slice;
+  int dma_timer;
+  int chan[2];
+  adpcm_state_t adpcm;
+  uint16_t block[2][VOICE_BLOCK_SAMPLES];
+} voice;
+
+static inline int16_t adpcm_decode_nibble(adpcm_state_t *s, uint8_t nibble) {
+  int32_t step = step_table[s->index];
+  int32_t diff = step >> 3;
+  if (nibble & 4) diff += step;
+  if (nibble & 2) diff += step >> 1;
+  if (nibble & 1) diff += step >> 2;
+  s->predictor += (nibble & 8) ? -diff : diff;
+  if (s->predictor > 32767) s->predictor = 32767;
+  else if (s->predictor < -32768) s->predictor = -32768;
+
+  s->index += index_table[nibble];
+  if (s->index < 0) s->index = 0;
+  else if (s->index > 88) s->index = 88;
+  return (int16_t) s->predictor;
+}
+
+// Decodifica um bloco em níveis de PWM; completa com silêncio no fim do clipe
+static bool __time_critical_func(fill_block)(uint16_t *out) {
+  adpcm_state_t *s = &voice.adpcm;
+  uint32_t n = s->remaining < VOICE_BLOCK_SAMPLES ? s->remaining : VOICE_BLOCK_SAMPLES;
+
+  for (uint32_t i = 0; i < n; ++i) {
+    uint8_t byte = *s->data;
+    uint8_t nibble = s->high_nibble ? (byte >> 4) : (byte & 0x0F);
+    if (s->high_nibble)
+      s->data++;
+    s->high_nibble = !s->high_nibble;
+
+    int16_t sample = adpcm_decode_nibble(s, nibble);
+    out[i] = (uint16_t) (((int32_t) sample + 32768) >> 8);
+  }
+  for (uint32_t i = n; i < VOICE_BLOCK_SAMPLES; ++i)
+    out[i] = (VOICE_PWM_WRAP + 1) / 2;
+
+  s->remaining -= n;
+  return n > 0;
+}
+
+static void __time_critical_func(voice_dma_irq)(void) {
+  for (int k = 0; k < 2; ++k) {
+    int ch = voice.chan[k];
+    if (ch < 0 || !dma_channel_get_irq1_status(ch))
+      continue;
+    dma_channel_acknowledge_irq1(ch);
+    if (!voice.playing)
+      continue;
+
+    // O outro canal já está tocando; este bloco pode ser reescrito
+    if (!fill_block(voice.block[k]) && voice.tail_blocks-- == 0) {
+      voice_stop();
+      return;
+    }
+    dma_channel_set_read_addr(ch, voice.block[k], false);
+  }
+}
+
+// Ping-pong: cada canal encadeia o outro e avisa pela DMA_IRQ_1
+static void configure_channels(void) {
+  for (int k = 0; k < 2; ++k) {
+    dma_channel_config c = dma_channel_get_default_config(voice.chan[k]);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, dma_get_timer_dreq(voice.dma_timer));
+    channel_config_set_chain_to(&c, voice.chan[k ^ 1]);
+    // Escrita de 16 bits em CC é replicada nas duas metades (canais A e B)
+    dma_channel_configure(voice.chan[k], &c, &pwm_hw->slice[voice.slice].cc,
+                          voice.block[k], VOICE_BLOCK_SAMPLES, false);
+    dma_channel_set_irq1_enabled(voice.chan[k], true);
+  }
+}
+
+bool voice_init(uint gpio) {
+  voice.slice = pwm_gpio_to_slice_num(gpio);
+  voice.dma_timer = dma_claim_unused_timer(false);
+  voice.chan[0] = dma_claim_unused_channel(false);
+  voice.chan[1] = dma_claim_unused_channel(false);
+  if (voice.dma_timer < 0 || voice.chan[0] < 0 || voice.chan[1] < 0)
+    return false;
+  configure_channels();
+
+  // Prioridade mais baixa: o Wi-Fi e o I2C do OLED não esperam pela voz
+  irq_add_shared_handler(DMA_IRQ_1, voice_dma_irq, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
+  irq_set_priority(DMA_IRQ_1, PICO_LOWEST_IRQ_PRIORITY);
+  irq_set_enabled(DMA_IRQ_1, true);
+
+  voice.ready = true;
+  return true;
+}
+
+bool voice_play(char letter) {
+  if (!voice.ready)
+    return false;
+
+  const voice_clip_t *clip = NULL;
+  letter = (char) toupper((unsigned char) letter);
+  for (size_t i = 0; i < voice_clip_count; ++i) {
+    if (voice_clips[i].letter == letter) {
+      clip = &voice_clips[i];
+      break;
+    }
+  }
+  if (clip == NULL)
+    return false;
+
+  voice_stop();
+  voice.adpcm.data = clip->data;
+  voice.adpcm.remaining = clip->samples;
+  voice.adpcm.predictor = 0;
+  voice.adpcm.index = 0;
+  voice.adpcm.high_nibble = false;
+  voice.tail_blocks = 1;   // o último bloco com áudio ainda precisa terminar de tocar
+
+  // PWM como DAC: 8 bits na frequência máxima
+  pwm_config config = pwm_get_default_config();
+  pwm_config_set_wrap(&config, VOICE_PWM_WRAP);
+  pwm_config_set_clkdiv(&config, 1.0f);
+  pwm_init(voice.slice, &config, true);
+
+  // Timer de DMA na taxa do clipe: clk_sys * 1 / den
+  uint32_t den = clock_get_hz(clk_sys) / clip->sample_rate;
+  dma_timer_set_fraction(voice.dma_timer, 1, (uint16_t) (den > 0xFFFF ? 0xFFFF : den));
+
+  fill_block(voice.block[0]);
+  fill_block(voice.block[1]);
+  configure_channels();
+
+  voice.playing = true;
+  dma_start_channel_mask(1u << voice.chan[0]);
+  return true;
+}
+
+void voice_stop(void) {
+  if (!voice.ready)
+    return;
+  voice.playing = false;
+  // Desliga o encadeamento (canal aponta para si mesmo) antes de abortar,
+  // senão o canal abortado pode disparar o outro
+  for (int k = 0; k < 2; ++k)
+    hw_write_masked(&dma_hw->ch[voice.chan[k]].al1_ctrl,
+                    (uint32_t) voice.chan[k] << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB,
+                    DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS);
+  for (int k = 0; k < 2; ++k) {
+    dma_channel_abort(voice.chan[k]);
+    dma_channel_acknowledge_irq1(voice.chan[k]);
+  }
+  pwm_set_enabled(voice.slice, false);
+}
+
+bool voice_is_playing(void) {
+  return voice.playing;
+}
@@ -0,0 +1,37 @@
+#ifndef VOICE_H
+#define VOICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pico/stdlib.h"
+
+// ---------------------------------------------------------------------
+// Reprodução de voz (IMA-ADPCM) no buzzer via PWM + DMA
+//
+// Os clipes ficam na flash (gerados por tools/pack_voice.py a partir de
+// voice/*.wav). Dois canais de DMA se revezam enviando blocos de níveis
+// de PWM, cadenciados por um timer de DMA na taxa do clipe; a IRQ de fim
+// de bloco só decodifica o próximo bloco.
+// ---------------------------------------------------------------------
+
+#define VOICE_BLOCK_SAMPLES  256   // amostras por bloco (2 blocos em RAM)
+#define VOICE_PWM_WRAP       255   // PWM de 8 bits: portadora de ~488 kHz
+
+typedef struct {
+  char letter;
+  uint16_t sample_rate;     // 8000 a 16000 Hz
+  uint32_t samples;
+  const uint8_t *data;      // nibbles IMA-ADPCM, o menos significativo primeiro
+} voice_clip_t;
+
+// Tabela gerada no build (voice_clips.c)
+extern const voice_clip_t voice_clips[];
+extern const size_t voice_clip_count;
+
+bool voice_init(uint gpio);
+bool voice_play(char letter);
+void voice_stop(void);
+bool voice_is_playing(void);
+
+#endif
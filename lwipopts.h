@@ -9,15 +9,25 @@
 #ifndef LWIP_SOCKET
 #define LWIP_SOCKET                 0
 #endif
-#if PICO_CYW43_ARCH_POLL
+#if PICO_CYW43_ARCH_POLL && !BITBRAILLE_ZERO_HEAP
 #define MEM_LIBC_MALLOC             1
 #else
 // MEM_LIBC_MALLOC is incompatible with non polling versions
+// (and with BITBRAILLE_ZERO_HEAP: lwIP uses its static ram_heap and pools)
 #define MEM_LIBC_MALLOC             0
 #endif
+#define MEMP_MEM_MALLOC             0
 #define MEM_ALIGNMENT               4
-#define MEM_SIZE                    4000
-#define MEMP_NUM_TCP_SEG            32
+// Respostas de fs_open_custom são copiadas para os segmentos TCP (abaixo)
+#define MEM_SIZE                    16000
+#define MEMP_NUM_TCP_SEG            64
+// Quiz remoto: até QUIZ_MAX_CLIENTS (32) celulares respondendo juntos,
+// mais os que passam do limite (recebem "cheio") e quem lê o /quiz.json.
+// Cada resposta é uma conexão HTTP/1.0 curta; as que fecham ficam em
+// TIME_WAIT e são recicladas primeiro quando o pool de PCBs acaba.
+#define MEMP_NUM_TCP_PCB            52
+#define TCP_LISTEN_BACKLOG          1
+#define TCP_DEFAULT_LISTEN_BACKLOG  32
 #define MEMP_NUM_ARP_QUEUE          10
 #define PBUF_POOL_SIZE              24
 #define LWIP_ARP                    1
@@ -89,4 +99,21 @@
 #define LWIP_HTTPD_SSI 1
 #define LWIP_HTTPD_CGI 1
 #define LWIP_HTTPD_SSI_INCLUDE_TAG 0
-#define HTTPD_FSDATA_FILE "htmldata.c"
\ No newline at end of file
+// Respostas geradas em tempo de execução (fs_open_custom em projeto_final.c)
+#define LWIP_HTTPD_CUSTOM_FILES 1
+// Cada uma vem de um buffer por conexão, devolvido em fs_close_custom assim
+// que o último pedaço é enfileirado: o tcp_write precisa copiar esses dados
+// para que uma retransmissão não leia um buffer já reaproveitado. Os
+// arquivos do fsdata continuam sendo enviados direto da flash.
+#define HTTP_IS_DATA_VOLATILE(hs)   (((hs)->handle != NULL && (hs)->handle->is_custom_file) ? TCP_WRITE_FLAG_COPY : 0)
+// Upload de pacotes de aula (httpd_post_* em projeto_final.c). A janela
+// do POST é liberada pelo loop principal, depois de gravar na flash.
+#define LWIP_HTTPD_SUPPORT_POST 1
+#define LWIP_HTTPD_POST_MANUAL_WND 1
+#define HTTPD_FSDATA_FILE "htmldata.c"
+// Estado das conexões do httpd em pools fixos (sem disputar o MEM_SIZE).
+// Sem estado livre o httpd aborta a conexão (RST): a rajada do quiz
+// precisa caber aqui (tools/quiz_sim.py usa o mesmo limite)
+#define HTTPD_USE_MEM_POOL 1
+#define MEMP_NUM_PARALLEL_HTTPD_CONNS 48
+#define MEMP_NUM_PARALLEL_HTTPD_SSI_CONNS 8
\ No newline at end of file
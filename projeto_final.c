@@ -9,15 +9,28 @@
 #include "hardware/adc.h"
 #include "hardware/i2c.h"
 #include "hardware/gpio.h"
+#include "hardware/sync.h"
+#include "hardware/structs/xip_ctrl.h"
 #include "pico/cyw43_arch.h"
 #include "lwip/apps/httpd.h"
+#include "lwip/apps/fs.h"
 
 // Para exibir IP no display ou console:
 #include "lwip/netif.h"
 #include "lwip/ip_addr.h"
 
 #include "inc/ssd1306.h"
-#include "ws2812.pio.h"
+#include "inc/braille_scroll.h"
+#include "inc/trace.h"
+#include "inc/buttons.h"
+#include "inc/lesson_pack.h"
+#include "inc/voice.h"
+#include "inc/input_record.h"
+#include "inc/mirror.h"
+#include "inc/led_panels.h"
+#include "inc/quiz.h"
+#include "inc/joystick.h"
+#include "oled_screens.h"
 
 // ---------------------------------------------------------------------
 // DEFINES
@@ -33,12 +46,44 @@
 #define BTN_B            6
 #define BTN_A            5
 
+// Linhas de texto no OLED. Em 64 px com folga; em 32 px são 4 linhas
+// de 8 px (as telas fixas seguem o mesmo arranjo, tools/prerender_screens.py)
+#if HEIGHT == 32
+#define OLED_OPTION_Y(i)     (8 + (i) * 8)     // abaixo de "Letra:"
+#define OLED_FEEDBACK_Y      20                // tempo sob "Correto!"/"Errado!"
+#define OLED_SCORE_Y         20                // placar sob "Fim da aula"
+#define OLED_IP_Y            16
+#define OLED_QUIZ_COUNT_Y    12
+#define OLED_QUIZ_OPTIONS_Y  24
+#define OLED_RANK_Y(i)       (8 + (i) * 8)
+#else
+#define OLED_OPTION_Y(i)     (16 + (i) * 14)
+#define OLED_FEEDBACK_Y      40
+#define OLED_SCORE_Y         35
+#define OLED_IP_Y            25
+#define OLED_QUIZ_COUNT_Y    20
+#define OLED_QUIZ_OPTIONS_Y  36
+#define OLED_RANK_Y(i)       (16 + (i) * 16)
+#endif
+
 // LED para indicar status Wi-Fi
 #define LED_WIFI         12
 
-// Neopixel
+// Painéis WS2812: pino, largura, altura, ordem dos LEDs e posição na tela
+// lógica, cada um numa state machine do pio0 (o cyw43 usa o pio1). Para
+// leitura de palavras, acrescente painéis ao lado da matriz, ex.:
+//     PANEL(8, 32, 8, LED_LAYOUT_COLUMNS | LED_LAYOUT_SERPENTINE, 5, 0)
+// NUM_LEDS, o framebuffer e a largura da rolagem acompanham a tabela.
 #define NEOPIXEL_PIN     7
-#define NUM_LEDS         25
+#define LED_PANEL_TABLE(PANEL) \
+    PANEL(NEOPIXEL_PIN, 5, 5, LED_LAYOUT_BITDOGLAB, 0, 0)
+
+#define LED_PANEL_ENTRY(pin, w, h, layout, x, y)  { pin, w, h, layout, x, y },
+#define LED_PANEL_LEDS(pin, w, h, layout, x, y)   + (w) * (h)
+#define NUM_LEDS         (0 LED_PANEL_TABLE(LED_PANEL_LEDS))
+
+// Cela exibida com has_letter: colunas 2-3 da tela lógica, pontos 1-3 e 4-6
+#define BRAILLE_CELL_X   2
 
 // Buzzers
 #define BUZZER_A         21
@@ -47,11 +92,29 @@
 #define DEFEAT_FREQ      300
 #define SOUND_DURATION   500  // 500ms
 
-// Limiar Joystick
-#define THRESHOLD_UP     1000
-#define THRESHOLD_DOWN   2100
+// Período do loop principal (limita a latência de entrega dos eventos)
+#define LOOP_PERIOD_MS   10
+
+// Aulas gravadas na flash: tempo do feedback antes do avanço automático
+#define LESSON_FEEDBACK_MS 1500
 
-#define DEADZONE         200
+// Gravação/reprodução das entradas (mesmo buffer para os dois)
+#define INPUT_LOG_SIZE   4096
+// Passos do relógio da reprodução por volta do loop (limita replay=0)
+#define REPLAY_MAX_STEPS 100
+
+// Buffers das respostas geradas dinamicamente (fs_open_custom): um grande
+// para /trace.bin, /rec.bin e /lessons.json e vários pequenos para os
+// JSON de estado e o espelho, um por conexão em andamento
+#define HTTP_HEADER_RESERVE  128
+#define HTTP_CUSTOM_BUF_SIZE (HTTP_HEADER_RESERVE + sizeof(trace_header_t) + TRACE_CAPACITY * sizeof(trace_record_t))
+#define HTTP_SMALL_BUF_SIZE  (HTTP_HEADER_RESERVE + 2048)
+#define HTTP_SMALL_SLOTS     8
+
+// Variante de build (CMake: BITBRAILLE_VARIANT)
+#ifndef BITBRAILLE_VARIANT_NAME
+#define BITBRAILLE_VARIANT_NAME "default"
+#endif
 
 // Estrutura do display
 ssd1306_t disp;
@@ -61,29 +124,27 @@ bool has_letter = false;
 
 // Letra atual e opções
 char current_letter;
+char expected_answer;
 char options[3];
 int selected_option = 0;
 
-// Vetor do WS2812 (25 LEDs)
-uint32_t led_matrix[NUM_LEDS];
+// Instante em que a cela atual apareceu na matriz e último tempo de reação
+static uint64_t cell_shown_us = 0;
+static volatile bool cell_pending = false;   // cela desenhada, ainda não enviada
+uint32_t last_reaction_ms = 0;
 
-// Mapeamento WS2812 5x5
-static const uint8_t LEDmap[5][5] = {
-    {24, 23, 22, 21, 20},
-    {15, 16, 17, 18, 19},
-    {14, 13, 12, 11, 10},
-    { 5,  6,  7,  8,  9},
-    { 4,  3,  2,  1,  0}
-};
+// Placar desde o boot (/status.json)
+static uint32_t answers_correct = 0;
+static uint32_t answers_wrong = 0;
+static uint32_t answers_timeout = 0;
 
-// Braille
-const int braille_leds[6] = {
-    17, // LEDmap[1][2]
-    12, // LEDmap[2][2]
-    7,  // LEDmap[3][2]
-    18, // LEDmap[1][3]
-    11, // LEDmap[2][3]
-    8   // LEDmap[3][3]
+// Vetor do WS2812 (todos os painéis, na ordem de led_panel_layout)
+uint32_t led_matrix[NUM_LEDS];
+static uint32_t led_tx[NUM_LEDS];   // cópia em envio pelo DMA
+static volatile bool leds_dirty = false;   // quadro novo para update_leds()
+
+static const led_panel_t led_panel_layout[] = {
+    LED_PANEL_TABLE(LED_PANEL_ENTRY)
 };
 
 // Mapa Braille (A-Z)
@@ -129,12 +190,95 @@ typedef struct {
 BuzzerState buzzerA_state = { false };
 BuzzerState buzzerB_state = { false };
 
+// Rolagem de palavras na matriz 5x5
+braille_scroll_t scroll;
+
 // ---------------------------------------------------------------------
 // Para sabermos se estamos exibindo a tela "Correto!/Errado!"
 // e, portanto, não deixar o joystick funcionar
 // ---------------------------------------------------------------------
 static bool showing_feedback = false;
 
+// ---------------------------------------------------------------------
+// Aula em execução: as celas são lidas direto da flash (XIP), sem cópia
+// ---------------------------------------------------------------------
+typedef struct {
+    bool active;
+    uint8_t number;
+    const lesson_cell_t *cells;
+    uint16_t count;
+    uint16_t pos;
+    uint16_t correct;
+    bool has_deadline;
+    absolute_time_t deadline;   // tempo limite para responder a cela atual
+    bool waiting_next;
+    absolute_time_t next_at;    // avanço automático após o feedback
+} LessonRun;
+
+static LessonRun lesson = { false };
+
+// ---------------------------------------------------------------------
+// Gravação e reprodução das entradas (joystick, botões, CGI)
+// ---------------------------------------------------------------------
+static uint8_t input_log[INPUT_LOG_SIZE];
+static size_t input_log_len = 0;
+static input_recorder_t recorder = { 0 };
+static input_replayer_t replayer = { 0 };
+static bool replaying = false;
+static int last_recorded_zone = -1;      // joystick_zone_t da última amostra gravada
+static joystick_gate_t joystick_gate;     // intervalo entre movimentos do joystick
+
+// ---------------------------------------------------------------------
+// Espelho remoto (/mirror.cgi): o "seq" de cada quadro e as referências
+// das diferenças ficam em inc/mirror.c
+// ---------------------------------------------------------------------
+static mirror_t mirror;
+static uint32_t mirror_since = 0;
+
+// ---------------------------------------------------------------------
+// Cache da XIP: ctr_hit/ctr_acc saturam em 0xFFFFFFFF (não dão a volta) e
+// só zeram quando escritos. O loop principal lê e zera os dois a cada
+// XIP_STATS_MS; o /status.json mostra o último intervalo completo.
+// ---------------------------------------------------------------------
+#define XIP_STATS_MS     1000
+static uint32_t xip_hit_last = 0, xip_acc_last = 0;
+static absolute_time_t xip_next_sample;
+
+// ---------------------------------------------------------------------
+// Quiz remoto (/quiz.cgi): respostas chegam pelo lwIP, o OLED é
+// redesenhado no loop principal no máximo a cada QUIZ_OLED_MS
+// ---------------------------------------------------------------------
+#define QUIZ_OLED_MS     250
+static quiz_t quiz;
+static volatile bool quiz_dirty = false;
+static absolute_time_t quiz_next_draw;
+
+// ---------------------------------------------------------------------
+// Envio do framebuffer do OLED (todas as telas passam por aqui)
+// ---------------------------------------------------------------------
+static volatile bool oled_dirty = false;   // tela nova para update_oled()
+
+// Envio bloqueante por I2C (~23 ms): só no boot e no loop principal
+void oled_send() {
+    TRACE_BEGIN(TRACE_OLED_FLUSH, 0);
+    ssd1306_send_data(&disp);
+    TRACE_END(TRACE_OLED_FLUSH, 0);
+}
+
+// Chamada também do cgi_handler (IRQ do lwIP): só marca a tela, que é
+// enviada por update_oled() no loop principal, como update_neopixel()
+void oled_flush() {
+    oled_dirty = true;
+}
+
+// Envia a tela pendente. A marca é limpa antes do envio: se um CGI
+// redesenhar durante a transferência, a tela sai de novo no próximo ciclo.
+void update_oled() {
+    if (!oled_dirty) return;
+    oled_dirty = false;
+    oled_send();
+}
+
 // ---------------------------------------------------------------------
 // Funções de inicialização
 // ---------------------------------------------------------------------
@@ -151,25 +295,24 @@ void init_oled() {
     gpio_pull_up(SDA_PIN);
     gpio_pull_up(SCL_PIN);
 
-    ssd1306_init(&disp, 128, 64, false, OLED_ADDR, I2C_PORT);
+    ssd1306_init(&disp, false, OLED_ADDR, I2C_PORT);
     ssd1306_config(&disp);
-    ssd1306_fill(&disp, false);
-    ssd1306_draw_string(&disp, "Display ON", 5, 5);
-    ssd1306_send_data(&disp);
+    ssd1306_blit(&disp, oled_screen_display_on);
+    oled_send();
     printf("Display OLED inicializado.\n");
 }
 
 void init_neopixel() {
-    PIO pio = pio0;
-    int sm = 0;
-    uint offset = pio_add_program(pio, &ws2812_program);
-    ws2812_program_init(pio, sm, offset, NEOPIXEL_PIN, 800000, false);
+    uint16_t total = led_panels_init(pio0, led_panel_layout, count_of(led_panel_layout),
+                                     led_matrix, led_tx, NUM_LEDS);
+    hard_assert(total == NUM_LEDS);
 
     // Inicia todos apagados
     for (int i = 0; i < NUM_LEDS; i++) {
         led_matrix[i] = 0x000000;
-        pio_sm_put_blocking(pio, sm, 0 << 8);
     }
+    led_panels_show();
+    braille_scroll_init(&scroll, led_matrix, led_panels_index, led_panels_width(), braille_map, 0x00FF00);
     printf("Matriz WS2812B inicializada (apagada).\n");
 }
 
@@ -183,6 +326,10 @@ void adc_init_joystick() {
 // Funções do Buzzer não-bloqueante
 // ---------------------------------------------------------------------
 void start_buzzer(BuzzerState *state, uint gpio, uint freq, uint duration_ms) {
+    // O buzzer A é compartilhado com a voz: o tom interrompe a fala
+    if (gpio == BUZZER_A) {
+        voice_stop();
+    }
     state->active = true;
     state->end_time = make_timeout_time_ms(duration_ms);
 
@@ -203,6 +350,7 @@ void start_buzzer(BuzzerState *state, uint gpio, uint freq, uint duration_ms) {
 
     // 50% de duty cycle
     pwm_set_chan_level(slice, channel, wrap / 2);
+    TRACE_BEGIN(TRACE_BUZZER, slice);
 }
 
 void update_buzzer(BuzzerState *state) {
@@ -210,6 +358,7 @@ void update_buzzer(BuzzerState *state) {
     if (time_reached(state->end_time)) {
         pwm_set_chan_level(state->slice, state->channel, 0); // desliga
         state->active = false;
+        TRACE_END(TRACE_BUZZER, state->slice);
     }
 }
 
@@ -222,16 +371,32 @@ void set_pixel(int index, uint32_t color) {
     }
 }
 
+// Chamada também do cgi_handler (IRQ do lwIP): só marca o quadro, que é
+// enviado por update_leds() no loop principal
 void update_neopixel() {
-    PIO pio = pio0;
-    int sm = 0;
-    for (int i = 0; i < NUM_LEDS; i++) {
-        pio_sm_put_blocking(pio, sm, led_matrix[i] << 8);
+    leds_dirty = true;
+}
+
+// Envia o quadro pendente quando o anterior terminou (loop principal). O
+// envio segue por DMA em todos os painéis; aqui só se copia o quadro.
+void update_leds() {
+    if (!leds_dirty || led_panels_busy()) return;
+    leds_dirty = false;
+
+    TRACE_BEGIN(TRACE_WS2812_FRAME, NUM_LEDS);
+    led_panels_show();
+    TRACE_END(TRACE_WS2812_FRAME, NUM_LEDS);
+
+    // O tempo de reação conta a partir do envio da cela
+    if (cell_pending) {
+        cell_pending = false;
+        cell_shown_us = time_us_64();
     }
 }
 
 void display_braille(char letter) {
     if (!has_letter) return;
+    braille_scroll_stop(&scroll);
     // Apaga tudo
     for (int i = 0; i < NUM_LEDS; i++) {
         led_matrix[i] = 0x000000;
@@ -239,12 +404,13 @@ void display_braille(char letter) {
     int idx = letter - 'A';
     if (idx < 0 || idx > 25) return;
 
-    // Acende pontos
+    // Acende pontos: 1-3 na coluna da esquerda, 4-6 na da direita
     for (int i = 0; i < 6; i++) {
         if (braille_map[idx][i]) {
-            set_pixel(braille_leds[i], 0x00FF00); // verde
+            set_pixel(led_panels_index(BRAILLE_CELL_X + i / 3, SCROLL_TOP_ROW + i % 3), 0x00FF00); // verde
         }
     }
+    cell_pending = true;
     update_neopixel();
 }
 
@@ -264,8 +430,8 @@ void generate_options(char correct) {
 }
 
 void display_options() {
-    ssd1306_fill(&disp, false);
-    ssd1306_draw_string(&disp, "Letra:", 5, 0);
+    // Cabeçalho pré-renderizado no build; só as opções são desenhadas aqui
+    ssd1306_blit(&disp, oled_screen_letra);
 
     for (int i = 0; i < 3; i++) {
         char buf[20];
@@ -274,86 +440,347 @@ void display_options() {
         else
             snprintf(buf, sizeof(buf), "   %c", options[i]);
 
-        ssd1306_draw_string(&disp, buf, 10, 16 + i * 14);
+        ssd1306_draw_string(&disp, buf, 10, OLED_OPTION_Y(i));
     }
-    ssd1306_send_data(&disp);
+    oled_flush();
 }
 
 // ---------------------------------------------------------------------
-// Callback GPIO
+// Aulas (pacote binário na flash)
 // ---------------------------------------------------------------------
-void my_gpio_callback(uint gpio, uint32_t events) {
+void lesson_show_cell() {
+    const lesson_cell_t *cell = &lesson.cells[lesson.pos];
+
+    current_letter = (char) toupper(cell->letter);
+    expected_answer = (char) toupper(cell->answer ? cell->answer : cell->letter);
+    has_letter = true;
+    showing_feedback = false;
+    lesson.waiting_next = false;
+
+    display_braille(current_letter);
+    if ((cell->flags & LESSON_CELL_SHUFFLE) || cell->options[0] == 0) {
+        generate_options(expected_answer);
+    } else {
+        for (int i = 0; i < 3; i++) {
+            options[i] = (char) toupper(cell->options[i]);
+        }
+        selected_option = 0;
+    }
+    display_options();
+
+    lesson.has_deadline = cell->time_ms != 0;
+    if (lesson.has_deadline) {
+        lesson.deadline = make_timeout_time_ms(cell->time_ms);
+    }
+}
+
+bool lesson_start(uint8_t number) {
+    const lesson_index_t *idx = lesson_pack_lesson(number);
+    if (idx == NULL || idx->cell_count == 0) return false;
+
+    lesson.active = true;
+    lesson.number = number;
+    lesson.cells = lesson_pack_cells(idx);
+    lesson.count = idx->cell_count;
+    lesson.pos = 0;
+    lesson.correct = 0;
+    printf("Aula %u: %.*s (%u celas)\n", number, LESSON_NAME_LEN, idx->name, idx->cell_count);
+    lesson_show_cell();
+    return true;
+}
+
+void lesson_advance() {
+    if (++lesson.pos < lesson.count) {
+        lesson_show_cell();
+        return;
+    }
+
+    // Fim da aula: mostra o placar
+    char buf[20];
+    lesson.active = false;
+    has_letter = false;
+    showing_feedback = false;
+    snprintf(buf, sizeof(buf), "%u/%u", lesson.correct, lesson.count);
+    ssd1306_blit(&disp, oled_screen_fim_aula);
+    ssd1306_draw_string(&disp, buf, 45, OLED_SCORE_Y);
+    oled_flush();
+}
+
+// ---------------------------------------------------------------------
+// Callback GPIO: só carimba o tempo e agenda o debounce (inc/buttons.c)
+// ---------------------------------------------------------------------
+void __time_critical_func(my_gpio_callback)(uint gpio, uint32_t events) {
+    TRACE_BEGIN(TRACE_GPIO_IRQ, gpio);
+    buttons_gpio_irq(gpio, events);
+    TRACE_END(TRACE_GPIO_IRQ, gpio);
+}
+
+// ---------------------------------------------------------------------
+// Gravação a partir do loop principal. O cgi_handler também grava, do IRQ
+// do lwIP: com as interrupções desligadas ele não entra no meio de um
+// evento que o loop esteja escrevendo.
+// ---------------------------------------------------------------------
+void record_button_event(const button_event_t *ev) {
+    uint32_t irq = save_and_disable_interrupts();
+    if (recorder.active) {
+        input_record_button(&recorder, ev->time_us, ev->gpio, ev->type);
+    }
+    restore_interrupts(irq);
+}
+
+void record_adc_event(uint64_t now_us, uint16_t raw_x) {
+    uint32_t irq = save_and_disable_interrupts();
+    if (recorder.active) {
+        input_record_adc(&recorder, now_us, raw_x);
+    }
+    restore_interrupts(irq);
+}
+
+// Decisões tomadas ao vivo, para tools/replay_host.c conferir a reprodução
+void record_decision(uint64_t now_us, char kind, int option) {
+    uint32_t irq = save_and_disable_interrupts();
+    if (recorder.active) {
+        input_record_decision(&recorder, now_us, kind, (uint8_t) option);
+    }
+    restore_interrupts(irq);
+}
+
+// ---------------------------------------------------------------------
+// Avaliação da resposta (botão B ou tempo esgotado na aula)
+// ---------------------------------------------------------------------
+void submit_answer(uint64_t time_us, bool timed_out) {
+    // Tempo de reação medido com o carimbo da IRQ, não com a hora do loop
+    // (resposta antes de a cela ser enviada conta como 0)
+    last_reaction_ms = (cell_pending || time_us < cell_shown_us) ? 0
+                     : (uint32_t) ((time_us - cell_shown_us) / 1000);
+    bool correct = !timed_out && options[selected_option] == expected_answer;
+    if (!timed_out) record_decision(time_us, 'r', selected_option);
+    if (timed_out) answers_timeout++;
+    else if (correct) answers_correct++;
+    else answers_wrong++;
+    char buf[20];
+    if (timed_out)
+        snprintf(buf, sizeof(buf), "Tempo!");
+    else
+        snprintf(buf, sizeof(buf), "%lu ms", (unsigned long) last_reaction_ms);
+
+    if (correct) {
+        // Vitória: buzzer A
+        start_buzzer(&buzzerA_state, BUZZER_A, VICTORY_FREQ, SOUND_DURATION);
+        ssd1306_blit(&disp, oled_screen_correto);
+    } else {
+        // Erro: buzzer B
+        // ATENÇÃO: use BUZZER_B como segundo parâmetro (GPIO),
+        //          e DEFEAT_FREQ como frequência
+        start_buzzer(&buzzerB_state, BUZZER_B, DEFEAT_FREQ, SOUND_DURATION);
+        ssd1306_blit(&disp, oled_screen_errado);
+    }
+    ssd1306_draw_string(&disp, buf, 35, OLED_FEEDBACK_Y);
+    oled_flush();
+    printf("Resposta %c em %lu ms\n", options[selected_option], (unsigned long) last_reaction_ms);
+
+    // Entra na tela de feedback => joystick travado
+    showing_feedback = true;
+    has_letter = false;
+
+    if (lesson.active) {
+        if (correct) lesson.correct++;
+        lesson.has_deadline = false;
+        const lesson_cell_t *cell = &lesson.cells[lesson.pos];
+        if (cell->flags & LESSON_CELL_AUTO_NEXT) {
+            lesson.waiting_next = true;
+            lesson.next_at = make_timeout_time_ms(LESSON_FEEDBACK_MS);
+        }
+    }
+}
+
+// Tempo limite da cela e avanço automático (loop principal)
+void update_lesson() {
+    if (!lesson.active) return;
+
+    if (has_letter && !showing_feedback && lesson.has_deadline && time_reached(lesson.deadline)) {
+        submit_answer(time_us_64(), true);
+    } else if (lesson.waiting_next && time_reached(lesson.next_at)) {
+        lesson_advance();
+    }
+}
+
+// ---------------------------------------------------------------------
+// Quiz remoto: a cela aparece na matriz e as opções nos celulares
+// ---------------------------------------------------------------------
+void quiz_round_begin(char letter) {
+    lesson.active = false;
+    current_letter = (char) toupper(letter);
+    expected_answer = current_letter;
+
+    // display_braille só desenha com has_letter; depois os controles da
+    // placa ficam parados, quem responde são os celulares
+    has_letter = true;
+    display_braille(current_letter);
+    generate_options(current_letter);
+    has_letter = false;
+    showing_feedback = false;
+
+    quiz_start(&quiz, current_letter, options, time_us_64());
+    quiz_dirty = true;
+    printf("Quiz: rodada %u, letra %c\n", quiz.round, current_letter);
+}
+
+void quiz_round_end() {
+    if (!quiz.open) return;
+    quiz_close(&quiz);
+    quiz_dirty = true;
+    start_buzzer(&buzzerA_state, BUZZER_A, VICTORY_FREQ, SOUND_DURATION);
+    printf("Quiz encerrado: %u de %u acertaram\n", quiz.correct, quiz.count);
+}
+
+// Resumo no OLED: contagem durante a rodada, pódio depois
+void update_quiz_display() {
+    if (!quiz_dirty || !time_reached(quiz_next_draw)) return;
+    quiz_dirty = false;
+    quiz_next_draw = make_timeout_time_ms(QUIZ_OLED_MS);
+
+    char buf[24];
+    ssd1306_fill(&disp, false);
+    if (quiz.open) {
+        snprintf(buf, sizeof(buf), "Quiz %u", quiz.round);
+        ssd1306_draw_string(&disp, buf, 0, 0);
+        snprintf(buf, sizeof(buf), "Respostas %u", quiz.count);
+        ssd1306_draw_string(&disp, buf, 0, OLED_QUIZ_COUNT_Y);
+        snprintf(buf, sizeof(buf), "Opcoes %.3s", quiz.options);
+        ssd1306_draw_string(&disp, buf, 0, OLED_QUIZ_OPTIONS_Y);
+    } else {
+        snprintf(buf, sizeof(buf), "%c %u/%u certas", quiz.letter, quiz.correct, quiz.count);
+        ssd1306_draw_string(&disp, buf, 0, 0);
+        for (uint8_t i = 0; i < 3; i++) {
+            const quiz_entry_t *e = quiz_ranked(&quiz, i);
+            if (e == NULL) break;
+            snprintf(buf, sizeof(buf), "%u %.7s %lu", i + 1, e->id, (unsigned long) e->time_ms);
+            ssd1306_draw_string(&disp, buf, 0, OLED_RANK_Y(i));
+        }
+    }
+    oled_flush();
+}
+
+// ---------------------------------------------------------------------
+// Eventos dos botões (loop principal)
+// ---------------------------------------------------------------------
+void handle_button_event(const button_event_t *ev) {
     // Botão A
-    if (gpio == BTN_A && (events & GPIO_IRQ_EDGE_FALL)) {
+    if (ev->gpio == BTN_A && ev->type == BUTTON_PRESS) {
+        // Em aula, A no feedback passa para a próxima cela
+        if (showing_feedback && lesson.active) {
+            lesson_advance();
+        }
         // Se estamos na tela "Correto!/Errado!", A volta às opções
-        if (showing_feedback) {
+        else if (showing_feedback) {
             display_options();       // Mostra as mesmas opções
             has_letter = true;       // Reativa joystick
             showing_feedback = false;
         }
     }
-    // Botão B -> Verifica se está correto ou errado
-    else if (gpio == BTN_B && (events & GPIO_IRQ_EDGE_FALL)) {
-        if (!has_letter) return;
-
-        if (options[selected_option] == current_letter) {
-            // Vitória: buzzer A
-            start_buzzer(&buzzerA_state, BUZZER_A, VICTORY_FREQ, SOUND_DURATION);
-            ssd1306_fill(&disp, false);
-            ssd1306_draw_string(&disp, "Correto!", 35, 25);
-        } else {
-            // Erro: buzzer B
-            // ATENÇÃO: use BUZZER_B como segundo parâmetro (GPIO),
-            //          e DEFEAT_FREQ como frequência
-            start_buzzer(&buzzerB_state, BUZZER_B, DEFEAT_FREQ, SOUND_DURATION);
-            ssd1306_fill(&disp, false);
-            ssd1306_draw_string(&disp, "Errado!", 35, 25);
+    // Botão A longo -> mostra a cela de novo e reinicia a contagem do tempo
+    else if (ev->gpio == BTN_A && ev->type == BUTTON_LONG_PRESS) {
+        if (has_letter && !showing_feedback) {
+            display_braille(current_letter);
         }
-        ssd1306_send_data(&disp);
-
-        // Entra na tela de feedback => joystick travado
-        showing_feedback = true;
-        has_letter = false;
+    }
+    // Botão B -> Verifica se está correto ou errado
+    else if (ev->gpio == BTN_B && ev->type == BUTTON_PRESS && has_letter) {
+        submit_answer(ev->time_us, false);
     }
 }
 
 // ---------------------------------------------------------------------
 // Joystick no Loop
 // ---------------------------------------------------------------------
+// Movimento do joystick no instante now_us: time_us_64() ao vivo ou o
+// instante do evento gravado (update_replay). Devolve true se moveu.
+bool joystick_step(uint64_t now_us, uint16_t raw_x) {
+    int next = joystick_select(&joystick_gate, now_us, raw_x, selected_option, 3);
+    if (next < 0) {
+        return false;
+    }
+    selected_option = next;
+    display_options();
+    voice_play(options[selected_option]);   // fala a letra escolhida
+    return true;
+}
+
+// Leitura do eixo X. Gravando, a amostra vira evento quando muda de zona
+// (cima/centro/baixo) ou quando a opção se move: joystick_select só muda
+// de estado nesses casos, então reavaliar só esses eventos, no mesmo
+// instante, reproduz as mesmas decisões.
 void read_joystick_and_select() {
+    uint64_t now = time_us_64();
     adc_select_input(0);
     uint16_t raw_x = adc_read();
 
-    static absolute_time_t last_move; 
-    const uint64_t MOVE_INTERVAL = 600000; // 600ms
-
-    if (absolute_time_diff_us(last_move, get_absolute_time()) < MOVE_INTERVAL) {
-        return;
+    bool moved = joystick_step(now, raw_x);
+    int zone = joystick_zone(raw_x);
+    if (moved || zone != last_recorded_zone) {
+        record_adc_event(now, raw_x);
+        last_recorded_zone = zone;
     }
-
-    // Sobe
-    if (raw_x < THRESHOLD_UP) {
-        selected_option = (selected_option + 1) % 3;
-        display_options();
-        last_move = get_absolute_time();
-    }
-    // Desce
-    else if (raw_x > THRESHOLD_DOWN) {
-        selected_option = (selected_option + 2) % 3; // -1 mod 3
-        display_options();
-        last_move = get_absolute_time();
+    if (moved) {
+        record_decision(now, 'o', selected_option);
     }
 }
 
 // ---------------------------------------------------------------------
 // CGI
 // ---------------------------------------------------------------------
+void input_record_begin() {
+    replaying = false;
+    last_recorded_zone = -1;
+    joystick_gate_reset(&joystick_gate);
+    input_record_start(&recorder, input_log, sizeof(input_log), time_us_64());
+    printf("Gravando entradas...\n");
+}
+
+void input_record_end() {
+    if (!recorder.active) return;
+    input_log_len = input_record_stop(&recorder);
+    printf("Gravacao: %lu eventos, %u bytes%s\n", (unsigned long) recorder.count,
+           (unsigned) input_log_len, recorder.full ? " (buffer cheio)" : "");
+}
+
+void input_replay_begin(uint16_t speed_pct) {
+    input_record_end();
+    if (!input_replay_start(&replayer, input_log, input_log_len, speed_pct, time_us_64())) {
+        printf("Nada para reproduzir.\n");
+        return;
+    }
+    replaying = true;
+    joystick_gate_reset(&joystick_gate);
+    TRACE_BEGIN(TRACE_REPLAY, speed_pct);
+    printf("Reproduzindo a %u%%\n", speed_pct);
+}
+
 const char *cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]) {
+    TRACE_BEGIN(TRACE_CGI, iNumParams);
     for (int i = 0; i < iNumParams; i++) {
+        // Controle da gravação: /send.cgi?rec=1 inicia, rec=0 encerra
+        if (strcmp(pcParam[i], "rec") == 0) {
+            if (atoi(pcValue[i])) input_record_begin();
+            else input_record_end();
+            continue;
+        }
+        // Reprodução da última gravação: /send.cgi?replay=100 (% da velocidade, 0 = máxima)
+        if (strcmp(pcParam[i], "replay") == 0) {
+            input_replay_begin((uint16_t) atoi(pcValue[i]));
+            continue;
+        }
+        if (recorder.active) {
+            input_record_cgi(&recorder, time_us_64(), pcParam[i], pcValue[i]);
+        }
+
         if (strcmp(pcParam[i], "letra") == 0 && strlen(pcValue[i]) == 1) {
-            // Recebemos uma letra, ativa joystick
+            // Recebemos uma letra, ativa joystick (e encerra uma aula em curso)
+            lesson.active = false;
             has_letter = true;
             current_letter = (char) toupper(pcValue[i][0]);
+            expected_answer = current_letter;
             printf("Letra recebida: %c\n", current_letter);
 
             display_braille(current_letter);
@@ -365,17 +792,435 @@ const char *cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcVal
 
             break;
         }
+        // Velocidade da rolagem (ms por coluna): /send.cgi?vel=100
+        else if (strcmp(pcParam[i], "vel") == 0) {
+            braille_scroll_set_speed(&scroll, (uint32_t) atoi(pcValue[i]));
+        }
+        // Palavra inteira rolando pela matriz: /send.cgi?palavra=CASA
+        // (ainda codificada na URL; braille_scroll_start decodifica)
+        else if (strcmp(pcParam[i], "palavra") == 0) {
+            if (braille_scroll_start(&scroll, pcValue[i])) {
+                printf("Palavra recebida: %s\n", pcValue[i]);
+                update_neopixel();
+            }
+        }
+        // Aula do pacote gravado na flash: /send.cgi?aula=0
+        else if (strcmp(pcParam[i], "aula") == 0) {
+            if (!lesson_start((uint8_t) atoi(pcValue[i]))) {
+                printf("Aula %s inexistente\n", pcValue[i]);
+            }
+        }
+        // Quiz remoto: /send.cgi?quiz=X abre a rodada com a letra X, quiz=0 encerra
+        else if (strcmp(pcParam[i], "quiz") == 0) {
+            if (isalpha((unsigned char) pcValue[i][0])) quiz_round_begin(pcValue[i][0]);
+            else quiz_round_end();
+        }
     }
+    TRACE_END(TRACE_CGI, iNumParams);
     return "/index.shtml";
 }
 
+// Resposta do quiz: /quiz.cgi?id=ana&r=B. O carimbo de tempo é o da chegada
+// e o corpo é um arquivo fixo do fsdata (sem buffer compartilhado na rajada).
+const char *quiz_cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]) {
+    uint64_t now = time_us_64();
+    const char *id = NULL;
+    char answer = 0;
+    for (int i = 0; i < iNumParams; i++) {
+        if (strcmp(pcParam[i], "id") == 0) id = pcValue[i];
+        else if (strcmp(pcParam[i], "r") == 0) answer = pcValue[i][0];
+    }
+
+    switch (quiz_answer(&quiz, id, answer, now)) {
+    case QUIZ_ACCEPTED:
+        quiz_dirty = true;
+        return "/quiz_ok.txt";
+    case QUIZ_DUPLICATE:
+        return "/quiz_dup.txt";
+    case QUIZ_CLOSED:
+        return "/quiz_closed.txt";
+    case QUIZ_FULL:
+        return "/quiz_full.txt";
+    default:
+        return "/quiz_err.txt";
+    }
+}
+
+// Espelho: /mirror.cgi?since=N devolve só o que mudou desde o quadro N
+const char *mirror_cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]) {
+    for (int i = 0; i < iNumParams; i++) {
+        if (strcmp(pcParam[i], "since") == 0) {
+            mirror_since = (uint32_t) strtoul(pcValue[i], NULL, 10);
+        }
+    }
+    return "/mirror.bin";
+}
+
 void cgi_init(void) {
     static const tCGI cgi_handlers[] = {
-        {"/send.cgi", cgi_handler}
+        {"/send.cgi", cgi_handler},
+        {"/mirror.cgi", mirror_cgi_handler},
+        {"/quiz.cgi", quiz_cgi_handler}
     };
+    mirror_init(&mirror);
     http_set_cgi_handlers(cgi_handlers, sizeof(cgi_handlers) / sizeof(tCGI));
 }
 
+// ---------------------------------------------------------------------
+// Reprodução (loop principal): o relógio gravado anda em passos de
+// LOOP_PERIOD_MS; em cada passo os eventos vencidos são entregues. O
+// joystick é avaliado em cada amostra gravada, no instante dela, como ao
+// vivo, então em 4x as opções escolhidas são as mesmas de 1x e da gravação.
+// ---------------------------------------------------------------------
+void update_replay() {
+    if (!replaying) return;
+
+    for (int step = 0; step < REPLAY_MAX_STEPS &&
+                       input_replay_tick(&replayer, time_us_64(), LOOP_PERIOD_MS * 1000); step++) {
+        input_event_t ev;
+        while (input_replay_next(&replayer, &ev)) {
+            TRACE_INSTANT(TRACE_INPUT, ev.type);
+            if (ev.type == INPUT_ADC) {
+                if (has_letter && !showing_feedback) {
+                    joystick_step(ev.t_us, ev.adc);
+                }
+            } else if (ev.type == INPUT_BUTTON) {
+                button_event_t bev = { time_us_64(), ev.button.gpio, ev.button.event };
+                handle_button_event(&bev);
+            } else if (ev.type == INPUT_CGI) {
+                char *param[1] = { ev.cgi.param };
+                char *value[1] = { ev.cgi.value };
+                cgi_handler(0, 1, param, value);
+            }
+            // INPUT_DECISION: só para conferência no PC (tools/replay_host.c)
+        }
+    }
+    if (input_replay_done(&replayer)) {
+        replaying = false;
+        TRACE_END(TRACE_REPLAY, replayer.speed_pct);
+        printf("Reproducao concluida.\n");
+    }
+}
+
+// ---------------------------------------------------------------------
+// Arquivos dinâmicos do httpd (LWIP_HTTPD_CUSTOM_FILES)
+// ---------------------------------------------------------------------
+typedef size_t (*http_render_fn)(uint8_t *out, size_t max);
+
+typedef struct {
+    const char *name;
+    const char *mime;
+    http_render_fn render;
+    bool large;             // precisa do buffer grande (só há um)
+} HttpCustomFile;
+
+static size_t render_trace(uint8_t *out, size_t max) {
+    return trace_snapshot(out, max);
+}
+
+// Aulas disponíveis no pacote e andamento da aula atual
+static size_t render_lessons(uint8_t *out, size_t max) {
+    char *buf = (char *) out;
+    const lesson_pack_header_t *hdr = lesson_pack_get();
+    size_t n = snprintf(buf, max, "{\"valid\":%s,\"lessons\":[", hdr ? "true" : "false");
+
+    for (uint8_t i = 0; hdr && i < hdr->lesson_count && n < max; i++) {
+        const lesson_index_t *idx = lesson_pack_lesson(i);
+        n += snprintf(buf + n, max - n, "%s{\"name\":\"%.*s\",\"cells\":%u}",
+                      i ? "," : "", LESSON_NAME_LEN, idx->name, idx->cell_count);
+    }
+    if (n < max) {
+        n += snprintf(buf + n, max - n, "],\"running\":%d,\"pos\":%u,\"correct\":%u}",
+                      lesson.active ? lesson.number : -1, lesson.pos, lesson.correct);
+    }
+    return n < max ? n : max;
+}
+
+// Última gravação de entradas (encerra a gravação em curso)
+static size_t render_recording(uint8_t *out, size_t max) {
+    input_record_end();
+    size_t n = input_log_len < max ? input_log_len : max;
+    memcpy(out, input_log, n);
+    return n;
+}
+
+// Quadro do OLED e da matriz, incremental em relação a mirror_since
+static size_t render_mirror(uint8_t *out, size_t max) {
+    mirror_frame_t frame = {
+        .oled = disp.ram_buffer + 1,            // pula o byte de controle 0x40
+        .oled_len = SSD1306_BUFSIZE - 1,
+        .width = WIDTH,
+        .height = HEIGHT,
+        .page_major = true,
+        .leds = led_matrix,
+        .n_leds = NUM_LEDS < MIRROR_MAX_LEDS ? NUM_LEDS : MIRROR_MAX_LEDS,   // painel 0
+    };
+    size_t n = mirror_encode(&mirror, &frame, mirror_since, out, max);
+    mirror_since = 0;                           // GET direto em /mirror.bin recebe quadro-chave
+    return n;
+}
+
+// Fecha o intervalo dos contadores da XIP (loop principal). A troca dos
+// dois valores é feita sem IRQ para o /status.json não misturar intervalos.
+void update_xip_stats() {
+    if (!time_reached(xip_next_sample)) return;
+    xip_next_sample = make_timeout_time_ms(XIP_STATS_MS);
+
+    uint32_t hit = xip_ctrl_hw->ctr_hit;
+    uint32_t acc = xip_ctrl_hw->ctr_acc;
+    xip_ctrl_hw->ctr_hit = 0;               // qualquer escrita zera
+    xip_ctrl_hw->ctr_acc = 0;
+
+    uint32_t irq = save_and_disable_interrupts();
+    xip_hit_last = hit;
+    xip_acc_last = acc;
+    restore_interrupts(irq);
+}
+
+// Estado resumido da placa para o monitor da frota (tools/fleet_monitor.py).
+// xip_hit/xip_acc: acertos e acessos ao cache da XIP no último intervalo de
+// xip_interval_ms (update_xip_stats).
+static size_t render_status(uint8_t *out, size_t max) {
+    const uint8_t *mac = netif_default ? netif_default->hwaddr : (const uint8_t *) "\0\0\0\0\0\0";
+    // A letra vem do CGI: só A-Z entra no JSON, como os ids do quiz
+    char letter = current_letter;
+    bool show_letter = has_letter && isalpha((unsigned char) letter);
+    size_t n = snprintf((char *) out, max,
+                        "{\"device\":\"bitbraille\",\"mac\":\"%02x:%02x:%02x:%02x:%02x:%02x\","
+                        "\"uptime_ms\":%lu,\"letter\":\"%.*s\",\"feedback\":%s,"
+                        "\"correct\":%lu,\"wrong\":%lu,\"timeouts\":%lu,\"last_reaction_ms\":%lu,"
+                        "\"lesson\":%d,\"lesson_pos\":%u,\"recording\":%s,\"replaying\":%s,"
+                        "\"variant\":\"%s\",\"xip_hit\":%lu,\"xip_acc\":%lu,\"xip_interval_ms\":%u}",
+                        mac[0], mac[1], mac[2], mac[3], mac[4], mac[5],
+                        (unsigned long) to_ms_since_boot(get_absolute_time()),
+                        show_letter ? 1 : 0, &letter, showing_feedback ? "true" : "false",
+                        (unsigned long) answers_correct, (unsigned long) answers_wrong,
+                        (unsigned long) answers_timeout, (unsigned long) last_reaction_ms,
+                        lesson.active ? lesson.number : -1, lesson.pos,
+                        recorder.active ? "true" : "false", replaying ? "true" : "false",
+                        BITBRAILLE_VARIANT_NAME, (unsigned long) xip_hit_last,
+                        (unsigned long) xip_acc_last, XIP_STATS_MS);
+    return n < max ? n : max;
+}
+
+// Estado do quiz (ranking só depois de encerrada a rodada)
+static size_t render_quiz(uint8_t *out, size_t max) {
+    return quiz_render_json(&quiz, (char *) out, max);
+}
+
+static const HttpCustomFile custom_files[] = {
+    {"/trace.bin", "application/octet-stream", render_trace, true},
+    {"/lessons.json", "application/json", render_lessons, true},
+    {"/rec.bin", "application/octet-stream", render_recording, true},
+    {"/mirror.bin", "application/octet-stream", render_mirror, false},
+    {"/status.json", "application/json", render_status, false},
+    {"/quiz.json", "application/json", render_quiz, false},
+};
+
+// Cada resposta em andamento tem o seu buffer, guardado em file->pextension
+// e devolvido em fs_close_custom. O corpo é gerado a partir de
+// HTTP_HEADER_RESERVE e o cabeçalho é escrito logo antes dele. O tcp_write
+// copia esses dados (HTTP_IS_DATA_VOLATILE em lwipopts.h), então uma
+// retransmissão nunca lê um buffer que já passou para outra conexão.
+static uint8_t http_large_buf[HTTP_CUSTOM_BUF_SIZE] __attribute__((aligned(4)));
+static uint8_t http_small_buf[HTTP_SMALL_SLOTS][HTTP_SMALL_BUF_SIZE] __attribute__((aligned(4)));
+static bool http_large_busy = false;
+static uint32_t http_small_busy = 0;    // bit i = http_small_buf[i] em uso
+static_assert(INPUT_LOG_SIZE <= HTTP_CUSTOM_BUF_SIZE - HTTP_HEADER_RESERVE, "/rec.bin precisa caber no buffer HTTP");
+static_assert(QUIZ_JSON_MAX <= HTTP_SMALL_BUF_SIZE - HTTP_HEADER_RESERVE, "/quiz.json cheio precisa caber no buffer HTTP");
+static_assert(HTTP_SMALL_SLOTS <= 32, "http_small_busy tem 32 bits");
+
+// Sem buffer livre: os clientes tentam de novo no próximo ciclo
+static const char http_busy[] = "HTTP/1.0 503 Service Unavailable\r\n"
+                                "Retry-After: 1\r\n"
+                                "Content-Length: 0\r\n\r\n";
+
+static uint8_t *http_buf_take(bool large, size_t *size) {
+    if (large) {
+        if (http_large_busy) return NULL;
+        http_large_busy = true;
+        *size = sizeof(http_large_buf);
+        return http_large_buf;
+    }
+    for (int i = 0; i < HTTP_SMALL_SLOTS; i++) {
+        if (!(http_small_busy & (1u << i))) {
+            http_small_busy |= 1u << i;
+            *size = HTTP_SMALL_BUF_SIZE;
+            return http_small_buf[i];
+        }
+    }
+    return NULL;
+}
+
+static void http_buf_release(uint8_t *buf) {
+    if (buf == http_large_buf) {
+        http_large_busy = false;
+    } else if (buf != NULL) {
+        http_small_busy &= ~(1u << ((buf - http_small_buf[0]) / HTTP_SMALL_BUF_SIZE));
+    }
+}
+
+int fs_open_custom(struct fs_file *file, const char *name) {
+    for (size_t i = 0; i < sizeof(custom_files) / sizeof(custom_files[0]); i++) {
+        if (strcmp(name, custom_files[i].name) != 0) continue;
+
+        size_t size;
+        uint8_t *buf = http_buf_take(custom_files[i].large, &size);
+        file->pextension = buf;
+        file->flags = FS_FILE_FLAGS_HEADER_INCLUDED;
+        if (buf == NULL) {
+            file->data = http_busy;
+            file->len = sizeof(http_busy) - 1;
+            file->index = file->len;
+            return 1;
+        }
+
+        uint8_t *body = buf + HTTP_HEADER_RESERVE;
+        size_t len = custom_files[i].render(body, size - HTTP_HEADER_RESERVE);
+
+        char header[HTTP_HEADER_RESERVE];
+        int hlen = snprintf(header, sizeof(header),
+                            "HTTP/1.0 200 OK\r\n"
+                            "Content-Type: %s\r\n"
+                            "Content-Length: %u\r\n"
+                            "Cache-Control: no-store\r\n\r\n",
+                            custom_files[i].mime, (unsigned) len);
+        memcpy(body - hlen, header, hlen);
+
+        file->data = (const char *) (body - hlen);
+        file->len = (int) (hlen + len);
+        file->index = file->len;
+        return 1;
+    }
+    return 0;
+}
+
+void fs_close_custom(struct fs_file *file) {
+    http_buf_release((uint8_t *) file->pextension);
+    file->pextension = NULL;
+}
+
+// ---------------------------------------------------------------------
+// POST /lesson.bin: pacote de aula gravado na flash em streaming
+// POST /rec.bin:    gravação de entradas para reproduzir (RAM)
+//
+// A flash não pode ser apagada/gravada aqui (IRQ do lwIP): os dados do
+// pacote vão para a fila de lesson_pack e a janela TCP fica fechada
+// (post_auto_wnd = 0) até update_lesson_upload() gravar e liberar.
+// ---------------------------------------------------------------------
+static_assert(LESSON_QUEUE_SIZE >= TCP_WND, "a fila do upload precisa comportar a janela TCP");
+
+static void *rec_post_conn = NULL;
+static void *volatile lesson_post_conn = NULL;
+
+err_t httpd_post_begin(void *connection, const char *uri, const char *http_request,
+                       u16_t http_request_len, int content_len, char *response_uri,
+                       u16_t response_uri_len, u8_t *post_auto_wnd) {
+    if (content_len <= 0) {
+        return ERR_VAL;
+    }
+
+    if (strcmp(uri, "/rec.bin") == 0) {
+        if ((size_t) content_len > sizeof(input_log)) {
+            return ERR_VAL;
+        }
+        input_record_end();
+        replaying = false;
+        input_log_len = 0;
+        rec_post_conn = connection;
+        *post_auto_wnd = 1;
+    } else if (strcmp(uri, "/lesson.bin") == 0) {
+        // Um pacote por vez: o anterior ainda está sendo gravado
+        if (lesson_post_conn != NULL || !lesson_upload_begin((uint32_t) content_len)) {
+            return ERR_VAL;
+        }
+        // As celas da aula atual estão na região que será apagada
+        lesson.active = false;
+        has_letter = false;
+        lesson_post_conn = connection;
+        *post_auto_wnd = 0;
+    } else {
+        return ERR_VAL;
+    }
+    return ERR_OK;
+}
+
+err_t httpd_post_receive_data(void *connection, struct pbuf *p) {
+    err_t ret = ERR_VAL;
+    if (connection == rec_post_conn) {
+        ret = ERR_OK;
+        for (struct pbuf *q = p; q != NULL; q = q->next) {
+            if (input_log_len + q->len > sizeof(input_log)) {
+                rec_post_conn = NULL;
+                ret = ERR_VAL;
+                break;
+            }
+            memcpy(input_log + input_log_len, q->payload, q->len);
+            input_log_len += q->len;
+        }
+    } else if (connection == lesson_post_conn) {
+        ret = ERR_OK;
+        for (struct pbuf *q = p; q != NULL; q = q->next) {
+            if (!lesson_upload_queue((const uint8_t *) q->payload, q->len)) {
+                lesson_upload_abort();
+                ret = ERR_VAL;
+                break;
+            }
+        }
+    }
+    pbuf_free(p);
+    return ret;
+}
+
+// Chamado quando todo o corpo foi liberado com httpd_post_data_recved, ou
+// quando a conexão cai no meio do upload (o loop principal descarta o resto)
+void httpd_post_finished(void *connection, char *response_uri, u16_t response_uri_len) {
+    if (connection == rec_post_conn) {
+        rec_post_conn = NULL;
+        printf("Gravacao recebida: %u bytes\n", (unsigned) input_log_len);
+        snprintf(response_uri, response_uri_len, "/index.shtml");
+        return;
+    }
+    if (connection == lesson_post_conn) {
+        lesson_post_conn = NULL;
+    }
+    snprintf(response_uri, response_uri_len, "/lessons.json");
+}
+
+// Grava na flash o que chegou do pacote e devolve a janela TCP
+void update_lesson_upload() {
+    if (lesson_post_conn == NULL) {
+        if (lesson_upload_busy()) {
+            lesson_upload_abort();
+            printf("Pacote de aulas interrompido\n");
+        }
+        return;
+    }
+
+    size_t done;
+    if (lesson_upload_busy()) {
+        done = lesson_upload_service();
+        // Tudo gravado: valida antes de liberar os últimos bytes, porque é
+        // isso que faz o httpd responder com /lessons.json
+        if (lesson_upload_complete()) {
+            bool ok = lesson_upload_finish();
+            printf("Pacote de aulas %s\n", ok ? "gravado" : "invalido");
+        }
+    } else {
+        // A fila recusou dados: libera o que falta para o httpd encerrar
+        // o POST (ele limita ao que ainda não foi liberado)
+        done = TCP_WND;
+    }
+
+    cyw43_arch_lwip_begin();
+    while (done > 0 && lesson_post_conn != NULL) {
+        u16_t n = done > 0xFFFF ? 0xFFFF : (u16_t) done;
+        httpd_post_data_recved(lesson_post_conn, n);
+        done -= n;
+    }
+    cyw43_arch_lwip_end();
+}
+
 // ---------------------------------------------------------------------
 // MAIN
 // ---------------------------------------------------------------------
@@ -387,31 +1232,31 @@ int main() {
     init_neopixel();
     adc_init_joystick();
 
-    // Botoes
-    gpio_init(BTN_A);
-    gpio_set_dir(BTN_A, GPIO_IN);
-    gpio_pull_up(BTN_A);
-
-    gpio_init(BTN_B);
-    gpio_set_dir(BTN_B, GPIO_IN);
-    gpio_pull_up(BTN_B);
+    // Botoes (debounce por alarme, bordas de descida e subida)
+    buttons_init();
+    buttons_add(BTN_A);
+    buttons_add(BTN_B);
 
     // Buzzers
     gpio_set_function(BUZZER_A, GPIO_FUNC_PWM);
     gpio_set_function(BUZZER_B, GPIO_FUNC_PWM);
 
+    // Voz (ADPCM) no buzzer A: PWM como DAC alimentado por DMA
+    if (!voice_init(BUZZER_A)) {
+        printf("Sem DMA livre para a voz.\n");
+    }
+
     // Interrupções
-    gpio_set_irq_enabled_with_callback(BTN_A, GPIO_IRQ_EDGE_FALL, true, &my_gpio_callback);
-    gpio_set_irq_enabled(BTN_B, GPIO_IRQ_EDGE_FALL, true);
+    gpio_set_irq_enabled_with_callback(BTN_A, GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE, true, &my_gpio_callback);
 
     // Tela inicial: Procurando WIFI...
-    ssd1306_fill(&disp, false);
-    ssd1306_draw_string(&disp, "Procurando", 28, 20);
-    ssd1306_draw_string(&disp, "   WIFI...", 28, 30);
-    ssd1306_send_data(&disp);
+    ssd1306_blit(&disp, oled_screen_wifi_search);
+    oled_send();
 
     // Inicializa Wi-Fi
+    TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_INIT);
     if (cyw43_arch_init()) {
+        TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_FAILED);
         printf("Falha ao inicializar Wi-Fi.\n");
         return 1;
     }
@@ -419,30 +1264,32 @@ int main() {
     gpio_put(LED_WIFI, false);
 
     // Tenta conectar
+    TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_CONNECTING);
     while (cyw43_arch_wifi_connect_timeout_ms("SeuSSID", "SuaSenha123", CYW43_AUTH_WPA2_AES_PSK, 30000) != 0) {
+        TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_FAILED);
         printf("Tentando conectar...\n");
+        TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_CONNECTING);
     }
+    TRACE_INSTANT(TRACE_WIFI, TRACE_WIFI_CONNECTED);
     printf("Conectado ao Wi-Fi!\n");
     gpio_put(LED_WIFI, true);
 
     // --- Após conectar, exibe WIFI ON! e IP ---
     {
-        ssd1306_fill(&disp, false);
-        ssd1306_draw_string(&disp, "WIFI ON!", 40, 10);
+        ssd1306_blit(&disp, oled_screen_wifi_on);
 
         // Captura IP e exibe no display
         char ip_str[32];
         snprintf(ip_str, sizeof(ip_str), "%s", ip4addr_ntoa(netif_ip4_addr(netif_default)));
-        ssd1306_draw_string(&disp, ip_str, 10, 25);
+        ssd1306_draw_string(&disp, ip_str, 10, OLED_IP_Y);
 
-        ssd1306_send_data(&disp);
+        oled_send();
         sleep_ms(2000); 
     }
 
     // Exibe "BitBraile"
-    ssd1306_fill(&disp, false);
-    ssd1306_draw_string(&disp, "BitBraile", 30, 25);
-    ssd1306_send_data(&disp);
+    ssd1306_blit(&disp, oled_screen_bitbraile);
+    oled_send();
     sleep_ms(1000);
 
     // Inicia servidor HTTP
@@ -450,19 +1297,56 @@ int main() {
     cgi_init();
     printf("Servidor HTTP iniciado.\n");
 
+    // Primeiro intervalo da XIP começa aqui, sem o boot e a conexão ao Wi-Fi
+    xip_ctrl_hw->ctr_hit = 0;
+    xip_ctrl_hw->ctr_acc = 0;
+    xip_next_sample = make_timeout_time_ms(XIP_STATS_MS);
+
     // Loop principal
     while (1) {
         // Verifica se acabou o tempo de algum buzzer
         update_buzzer(&buzzerA_state);
         update_buzzer(&buzzerB_state);
 
-        // Só mexemos o joystick se has_letter == true e não estamos no feedback
-        if (has_letter && !showing_feedback) {
+        // Rolagem da palavra: só a coluna nova é escrita a cada passo
+        if (braille_scroll_update(&scroll)) {
+            update_neopixel();
+        }
+
+        // Eventos dos botões já com debounce
+        button_event_t ev;
+        while (buttons_poll(&ev)) {
+            record_button_event(&ev);
+            handle_button_event(&ev);
+        }
+
+        // Entradas gravadas (joystick, botões e CGI)
+        update_replay();
+
+        // Pacote de aulas recebido por POST: gravação na flash
+        update_lesson_upload();
+
+        // Tempo limite e avanço automático da aula
+        update_lesson();
+
+        // Resumo do quiz remoto no OLED
+        update_quiz_display();
+
+        // Só mexemos o joystick se has_letter == true e não estamos no
+        // feedback; na reprodução ele é avaliado em update_replay()
+        if (has_letter && !showing_feedback && !replaying) {
             read_joystick_and_select();
         }
 
+        // Contadores do cache da XIP, por intervalo
+        update_xip_stats();
+
+        // Quadro dos LEDs e tela do OLED marcados neste ciclo (ou pelo CGI)
+        update_leds();
+        update_oled();
+
         tight_loop_contents();
-        sleep_ms(50);
+        sleep_ms(LOOP_PERIOD_MS);
     }
     return 0;
 }
\ No newline at end of file
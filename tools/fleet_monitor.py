@@ -0,0 +1,213 @@
+#!/usr/bin/python3
+
+# Monitor da frota: descobre as placas BitBraille da rede e consulta o
+# /status.json de todas ao mesmo tempo (asyncio, uma thread, número de
+# conexões simultâneas limitado).
+#
+# Uso:
+#   python3 tools/fleet_monitor.py 192.168.0.0/24
+#   python3 tools/fleet_monitor.py 192.168.0.0/24 --csv frota.csv --interval 5
+#   python3 tools/fleet_monitor.py 127.0.0.1:8000-8199      # placas simuladas (fleet_sim.py)
+#
+# Alvos aceitos: rede CIDR, host, host:porta ou host:porta-porta.
+
+import argparse
+import asyncio
+import csv
+import ipaddress
+import json
+import sys
+import time
+
+COLUMNS = ['host', 'mac', 'state', 'latency_ms', 'uptime_s', 'letter', 'correct', 'wrong',
+           'timeouts', 'last_reaction_ms', 'lesson', 'variant', 'xip_hit_pct', 'xip_macc_s', 'errors']
+
+
+def parse_targets(specs):
+    targets = []
+    for spec in specs:
+        host, _, ports = spec.partition(':')
+        if ports:
+            first, _, last = ports.partition('-')
+            port_list = range(int(first), int(last or first) + 1)
+        else:
+            port_list = [80]
+        if '/' in host:
+            net = ipaddress.ip_network(host, strict=False)
+            hosts = [str(h) for h in net.hosts()] or [str(net.network_address)]
+        else:
+            hosts = [host]
+        targets += [(h, p) for h in hosts for p in port_list]
+    return targets
+
+
+async def fetch_status(target, timeout):
+    # HTTP/1.0 à mão: o httpd do lwIP fecha a conexão ao fim da resposta
+    host, port = target
+    start = time.perf_counter()
+    writer = None
+    try:
+        reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), timeout)
+        writer.write('GET /status.json HTTP/1.0\r\nHost: {}\r\n\r\n'.format(host).encode())
+        raw = await asyncio.wait_for(reader.read(), timeout)
+    finally:
+        if writer is not None:
+            writer.close()
+    latency = (time.perf_counter() - start) * 1000.0
+
+    head, _, body = raw.partition(b'\r\n\r\n')
+    if not head.startswith(b'HTTP/1.') or b' 200 ' not in head.split(b'\r\n', 1)[0]:
+        raise ValueError('resposta HTTP inválida')
+    status = json.loads(body)
+    if status.get('device') != 'bitbraille':
+        raise ValueError('não é uma placa BitBraille')
+    return status, latency
+
+
+class Board:
+    def __init__(self, target):
+        self.target = target
+        self.status = {}
+        self.latency = None
+        self.errors = 0
+        self.online = False
+
+    def row(self):
+        s = self.status
+        # xip_hit/xip_acc já são do último intervalo de xip_interval_ms na
+        # placa (os contadores do RP2040 saturam, então ela os zera)
+        xip_acc = s.get('xip_acc', 0)
+        xip_ms = s.get('xip_interval_ms', 0)
+        host = '{}:{}'.format(*self.target) if self.target[1] != 80 else self.target[0]
+        return {
+            'host': host,
+            'mac': s.get('mac', ''),
+            'state': 'online' if self.online else 'offline',
+            'latency_ms': '{:.1f}'.format(self.latency) if self.online else '',
+            'uptime_s': s.get('uptime_ms', 0) // 1000,
+            'letter': s.get('letter', ''),
+            'correct': s.get('correct', 0),
+            'wrong': s.get('wrong', 0),
+            'timeouts': s.get('timeouts', 0),
+            'last_reaction_ms': s.get('last_reaction_ms', 0),
+            'lesson': s.get('lesson', -1),
+            'variant': s.get('variant', ''),
+            'xip_hit_pct': '{:.1f}'.format(100.0 * s.get('xip_hit', 0) / xip_acc) if xip_acc else '',
+            'xip_macc_s': '{:.1f}'.format(xip_acc / xip_ms / 1000.0) if xip_acc and xip_ms else '',
+            'errors': self.errors,
+        }
+
+
+class Fleet:
+    def __init__(self, targets, concurrency, timeout):
+        self.targets = targets
+        self.timeout = timeout
+        self.sem = asyncio.Semaphore(concurrency)
+        self.boards = {}
+
+    async def probe(self, target):
+        async with self.sem:
+            try:
+                return target, await fetch_status(target, self.timeout)
+            except (OSError, asyncio.TimeoutError, ValueError):
+                return target, None
+
+    # Varre todos os alvos; quem responde como BitBraille entra na frota
+    async def discover(self):
+        results = await asyncio.gather(*(self.probe(t) for t in self.targets if t not in self.boards))
+        for target, result in results:
+            if result is None:
+                continue
+            board = self.boards[target] = Board(target)
+            board.status, board.latency = result
+            board.online = True
+
+    async def poll(self):
+        results = await asyncio.gather(*(self.probe(t) for t in self.boards))
+        for target, result in results:
+            board = self.boards[target]
+            board.online = result is not None
+            if result is None:
+                board.errors += 1
+            else:
+                board.status, board.latency = result
+
+    def rows(self):
+        return [self.boards[t].row() for t in sorted(self.boards)]
+
+
+def print_table(fleet, elapsed_ms):
+    rows = fleet.rows()
+    widths = {c: max([len(c)] + [len(str(r[c])) for r in rows]) for c in COLUMNS}
+    out = ['\x1b[H\x1b[2J']
+    out.append('  '.join(c.ljust(widths[c]) for c in COLUMNS))
+    for r in rows:
+        out.append('  '.join(str(r[c]).ljust(widths[c]) for c in COLUMNS))
+
+    online = [r for r in rows if r['state'] == 'online']
+    correct = sum(r['correct'] for r in rows)
+    answered = correct + sum(r['wrong'] + r['timeouts'] for r in rows)
+    lat = sorted(float(r['latency_ms']) for r in online)
+    out.append('')
+    out.append('{} de {} placas online | acertos {}/{} | latência p50 {} ms, máx {} ms | rodada em {:.0f} ms'.format(
+        len(online), len(rows), correct, answered,
+        '{:.1f}'.format(lat[len(lat) // 2]) if lat else '-',
+        '{:.1f}'.format(lat[-1]) if lat else '-', elapsed_ms))
+    sys.stdout.write('\n'.join(out) + '\n')
+    sys.stdout.flush()
+
+
+async def run(args):
+    fleet = Fleet(parse_targets(args.targets), args.concurrency, args.timeout)
+    start = time.perf_counter()
+    await fleet.discover()
+    print('{} placas encontradas em {} alvos ({:.1f} s)'.format(
+        len(fleet.boards), len(fleet.targets), time.perf_counter() - start), file=sys.stderr)
+
+    writer = None
+    if args.csv:
+        f = sys.stdout if args.csv == '-' else open(args.csv, 'w', newline='')
+        writer = csv.DictWriter(f, fieldnames=['time'] + COLUMNS)
+        writer.writeheader()
+
+    last_scan = time.monotonic()
+    while True:
+        start = time.perf_counter()
+        if args.rescan and time.monotonic() - last_scan >= args.rescan:
+            await fleet.discover()
+            last_scan = time.monotonic()
+        await fleet.poll()
+        elapsed = (time.perf_counter() - start) * 1000.0
+
+        if writer:
+            now = time.strftime('%Y-%m-%dT%H:%M:%S')
+            for row in fleet.rows():
+                writer.writerow(dict(row, time=now))
+            f.flush()
+        else:
+            print_table(fleet, elapsed)
+
+        if args.once:
+            return 0 if fleet.boards else 1
+        await asyncio.sleep(max(0.0, args.interval - elapsed / 1000.0))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Monitor da frota de placas BitBraille.')
+    parser.add_argument('targets', nargs='+', help='rede CIDR, host, host:porta ou host:porta-porta')
+    parser.add_argument('--concurrency', type=int, default=64, help='conexões simultâneas (padrão 64)')
+    parser.add_argument('--timeout', type=float, default=1.0, help='tempo limite por placa em s')
+    parser.add_argument('--interval', type=float, default=2.0, help='intervalo entre rodadas em s')
+    parser.add_argument('--rescan', type=float, default=60.0, help='nova descoberta a cada N s (0 = nunca)')
+    parser.add_argument('--csv', help='grava as rodadas em CSV ("-" para a saída padrão)')
+    parser.add_argument('--once', action='store_true', help='uma única rodada e sai')
+    args = parser.parse_args()
+
+    try:
+        return asyncio.run(run(args))
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,132 @@
+#!/usr/bin/python3
+
+# Placas BitBraille simuladas para testar o tools/fleet_monitor.py sem
+# hardware: cada porta responde o /status.json como o firmware, com
+# respostas de alunos e latências aleatórias.
+#
+# Uso:
+#   python3 tools/fleet_sim.py --count 200 --base-port 8000
+#   python3 tools/fleet_monitor.py 127.0.0.1:8000-8199
+
+import argparse
+import asyncio
+import json
+import random
+import sys
+import time
+
+XIP_STATS_MS = 1000      # projeto_final.c
+
+class SimBoard:
+    def __init__(self, index, args):
+        self.index = index
+        self.args = args
+        self.boot = time.monotonic()
+        self.letter = ''
+        self.correct = self.wrong = self.timeouts = 0
+        self.last_reaction_ms = 0
+        self.lesson = -1
+        self.lesson_pos = 0
+        self.variant = random.choice(['default', 'copy_to_ram', 'o2_lto', 'os'])
+
+    # Último intervalo de XIP_STATS_MS dos contadores da XIP: a placa os lê e
+    # zera a cada intervalo (saturam em 0xFFFFFFFF, não dão a volta)
+    def xip_interval(self):
+        if self.variant == 'copy_to_ram':
+            return 0, 0
+        acc = random.randint(5000000, 40000000)
+        return int(acc * random.uniform(0.90, 0.99)), acc
+
+    # Avança o "aluno" um pouco a cada consulta
+    def step(self):
+        r = random.random()
+        if r < 0.3:
+            self.letter = chr(ord('A') + random.randrange(26))
+        elif r < 0.5 and self.letter:
+            self.last_reaction_ms = random.randint(300, 4000)
+            outcome = random.random()
+            if outcome < 0.7:
+                self.correct += 1
+            elif outcome < 0.95:
+                self.wrong += 1
+            else:
+                self.timeouts += 1
+            self.letter = ''
+            if self.lesson >= 0:
+                self.lesson_pos += 1
+        elif r < 0.52:
+            self.lesson, self.lesson_pos = random.randrange(3), 0
+
+    def status(self):
+        xip_hit, xip_acc = self.xip_interval()
+        return {
+            'device': 'bitbraille',
+            'mac': '28:cd:c1:{:02x}:{:02x}:{:02x}'.format(0xF0, self.index >> 8, self.index & 0xFF),
+            'uptime_ms': int((time.monotonic() - self.boot) * 1000),
+            'letter': self.letter,
+            'feedback': False,
+            'correct': self.correct,
+            'wrong': self.wrong,
+            'timeouts': self.timeouts,
+            'last_reaction_ms': self.last_reaction_ms,
+            'lesson': self.lesson,
+            'lesson_pos': self.lesson_pos,
+            'recording': False,
+            'replaying': False,
+            'variant': self.variant,
+            'xip_hit': xip_hit,
+            'xip_acc': xip_acc,
+            'xip_interval_ms': XIP_STATS_MS,
+        }
+
+    async def handle(self, reader, writer):
+        try:
+            request = await reader.readuntil(b'\r\n\r\n')
+            await asyncio.sleep(random.uniform(self.args.min_latency, self.args.max_latency) / 1000.0)
+            if random.random() < self.args.drop:
+                return
+            path = request.split(b' ', 2)[1] if request.count(b' ') >= 2 else b''
+            if path == b'/status.json':
+                self.step()
+                body = json.dumps(self.status(), separators=(',', ':')).encode()
+                head = 'HTTP/1.0 200 OK\r\nContent-Type: application/json\r\nContent-Length: {}\r\n\r\n'
+            else:
+                body = b'<html><body><h2>404 - Page not found</h2></body></html>'
+                head = 'HTTP/1.0 404 File not found\r\nContent-Type: text/html\r\nContent-Length: {}\r\n\r\n'
+            writer.write(head.format(len(body)).encode() + body)
+            await writer.drain()
+        except (asyncio.IncompleteReadError, ConnectionError):
+            pass
+        finally:
+            writer.close()
+
+
+async def run(args):
+    servers = []
+    for i in range(args.count):
+        board = SimBoard(i, args)
+        servers.append(await asyncio.start_server(board.handle, args.host, args.base_port + i))
+    print('{} placas simuladas em {}:{}-{}'.format(
+        args.count, args.host, args.base_port, args.base_port + args.count - 1), file=sys.stderr)
+    await asyncio.gather(*(s.serve_forever() for s in servers))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Placas BitBraille simuladas (/status.json).')
+    parser.add_argument('--count', type=int, default=50, help='número de placas')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--base-port', type=int, default=8000, help='porta da primeira placa')
+    parser.add_argument('--min-latency', type=float, default=5.0, help='latência mínima em ms')
+    parser.add_argument('--max-latency', type=float, default=80.0, help='latência máxima em ms')
+    parser.add_argument('--drop', type=float, default=0.01, help='fração de consultas sem resposta')
+    args = parser.parse_args()
+
+    try:
+        asyncio.run(run(args))
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,98 @@
+// Confere no PC o atlas de glifos (oled_assets.c + inc/ssd1306_glyph.h)
+// contra o desenho pixel a pixel original com inc/font.h: para todo
+// caractere, toda posição x/y (inclusive cortada na borda) e as duas
+// alturas de painel, o framebuffer precisa sair igual byte a byte.
+//
+// Compilação e uso:
+//   python3 tools/prerender_screens.py --font inc/font.h -o /tmp/oled
+//   cc -O2 -Iinc -o glyph_check tools/glyph_check.c /tmp/oled/oled_assets.c
+//   ./glyph_check
+//
+// Sai com código 1 na primeira diferença.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ssd1306_glyph.h"
+#include "font.h"
+
+#define WIDTH 128
+#define MAX_PAGES 8
+
+// ssd1306_pixel original, sem o byte de controle
+static void pixel(uint8_t *pages, uint8_t height, uint8_t x, uint8_t y, bool value) {
+  if (x >= WIDTH || y >= height)
+    return;
+  uint16_t index = (y >> 3) * WIDTH + x;
+  if (value)
+    pages[index] |= 1 << (y & 7);
+  else
+    pages[index] &= ~(1 << (y & 7));
+}
+
+// ssd1306_draw_char original (antes do atlas)
+static void draw_char_pixels(uint8_t *pages, uint8_t height, char c, uint8_t x, uint8_t y) {
+  uint16_t index = 0;
+
+  if (c >= 'A' && c <= 'Z') {
+    index = (c - 'A' + 11) * 8;
+  } else if (c >= '0' && c <= '9') {
+    index = (c - '0' + 1) * 8;
+  } else if (c >= 'a' && c <= 'z') {
+    index = (c - 'a' + 37) * 8;
+  } else if (c >= '!' && c <= '/') {
+    index = (c - '!' + 63) * 8;
+  } else {
+    return;
+  }
+  // Fora da tabela: o gerador também não cria glifo
+  if (index + 8u > sizeof(font))
+    return;
+
+  for (uint8_t i = 0; i < 8; ++i) {
+    uint8_t line = font[index + i];
+    for (uint8_t j = 0; j < 8; ++j)
+      pixel(pages, height, x + i, y + j, line & (1 << j));
+  }
+}
+
+int main(void) {
+  static const uint8_t heights[] = { 32, 64 };
+  static uint8_t noise[WIDTH * MAX_PAGES];
+  static uint8_t ref[WIDTH * MAX_PAGES], got[WIDTH * MAX_PAGES];
+  unsigned long checked = 0;
+
+  // Fundo aleatório: o glifo precisa apagar e preservar os mesmos bits
+  srand(1);
+  for (size_t i = 0; i < sizeof(noise); ++i)
+    noise[i] = (uint8_t) rand();
+
+  for (size_t h = 0; h < sizeof(heights); ++h) {
+    uint8_t height = heights[h];
+    uint8_t pages = height / 8;
+    size_t size = (size_t) WIDTH * pages;
+
+    for (int code = 0; code < 256; ++code) {
+      char c = (char) code;
+      const uint8_t *glyph = ssd1306_glyph(c);
+      // x/y até 8 além da borda: cobre o corte e a posição inteira fora
+      for (int y = 0; y < height + 8; ++y) {
+        for (int x = 0; x < WIDTH + 8; ++x) {
+          memcpy(ref, noise, size);
+          memcpy(got, noise, size);
+          draw_char_pixels(ref, height, c, (uint8_t) x, (uint8_t) y);
+          if (glyph != NULL)
+            ssd1306_glyph_blit(got, WIDTH, pages, glyph, (uint8_t) x, (uint8_t) y);
+          if (memcmp(ref, got, size) != 0) {
+            printf("diferente: altura %u, caractere 0x%02x, x=%d, y=%d\n", height, code, x, y);
+            return 1;
+          }
+          checked++;
+        }
+      }
+    }
+  }
+
+  printf("%lu desenhos iguais (256 caracteres, alturas 32 e 64)\n", checked);
+  return 0;
+}
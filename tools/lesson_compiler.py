@@ -0,0 +1,152 @@
+#!/usr/bin/python3
+
+# Compila uma aula em texto para o pacote binário lido pelo firmware (inc/lesson_pack.h).
+#
+# Formato do texto (uma diretiva por linha, '#' inicia comentário):
+#
+#   aula Vogais
+#   cela A                          # alternativas sorteadas na placa
+#   cela E opcoes=EAI tempo=5000    # alternativas fixas, 5 s para responder
+#   cela I resposta=I auto          # avança sozinho após o feedback
+#
+# Uso:
+#   python3 tools/lesson_compiler.py lessons/exemplo.txt -o exemplo.bin
+#   curl --data-binary @exemplo.bin http://<ip>/lesson.bin
+#
+# O pacote precisa caber na região da placa (BITBRAILLE_LESSON_FLASH_SIZE):
+# se ela foi reduzida no CMake, passe o mesmo valor em --max-size. O build
+# já compila lessons/*.txt com o valor configurado.
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b'BBLP'
+VERSION = 1
+NAME_LEN = 12
+
+HEADER = struct.Struct('<4sBBHII')
+INDEX = struct.Struct('<{}sHH'.format(NAME_LEN))
+CELL = struct.Struct('<cc3sBH')
+
+CELL_SHUFFLE = 0x01
+CELL_AUTO_NEXT = 0x02
+
+MAX_PACK = 64 * 1024      # padrão de BITBRAILLE_LESSON_FLASH_SIZE
+
+
+class LessonError(Exception):
+    pass
+
+
+def parse_letter(value, lineno):
+    value = value.upper()
+    if len(value) != 1 or not ('A' <= value <= 'Z'):
+        raise LessonError('linha {}: letra inválida "{}"'.format(lineno, value))
+    return value
+
+
+def parse(text):
+    lessons = []
+    for lineno, line in enumerate(text.splitlines(), 1):
+        line = line.split('#', 1)[0].strip()
+        if not line:
+            continue
+        words = line.split()
+        cmd = words[0].lower()
+
+        if cmd == 'aula':
+            name = ' '.join(words[1:]) or 'Aula {}'.format(len(lessons))
+            if len(name.encode('utf-8')) > NAME_LEN:
+                raise LessonError('linha {}: nome da aula com mais de {} bytes'.format(lineno, NAME_LEN))
+            lessons.append({'name': name, 'cells': []})
+
+        elif cmd == 'cela':
+            if not lessons:
+                raise LessonError('linha {}: "cela" antes de "aula"'.format(lineno))
+            if len(words) < 2:
+                raise LessonError('linha {}: falta a letra da cela'.format(lineno))
+            cell = {'letter': parse_letter(words[1], lineno), 'answer': None,
+                    'options': None, 'flags': 0, 'time_ms': 0}
+            for opt in words[2:]:
+                key, _, value = opt.partition('=')
+                key = key.lower()
+                if key == 'opcoes':
+                    letters = [parse_letter(c, lineno) for c in value.replace(',', '')]
+                    if len(letters) != 3:
+                        raise LessonError('linha {}: "opcoes" precisa de 3 letras'.format(lineno))
+                    cell['options'] = ''.join(letters)
+                elif key == 'resposta':
+                    cell['answer'] = parse_letter(value, lineno)
+                elif key == 'tempo':
+                    cell['time_ms'] = int(value)
+                    if not 0 <= cell['time_ms'] <= 0xFFFF:
+                        raise LessonError('linha {}: tempo fora de 0..65535 ms'.format(lineno))
+                elif key == 'auto':
+                    cell['flags'] |= CELL_AUTO_NEXT
+                elif key == 'embaralhar':
+                    cell['flags'] |= CELL_SHUFFLE
+                else:
+                    raise LessonError('linha {}: opção desconhecida "{}"'.format(lineno, opt))
+
+            answer = cell['answer'] or cell['letter']
+            if cell['options'] is not None and answer not in cell['options']:
+                raise LessonError('linha {}: a resposta {} não está nas opções'.format(lineno, answer))
+            lessons[-1]['cells'].append(cell)
+
+        else:
+            raise LessonError('linha {}: diretiva desconhecida "{}"'.format(lineno, words[0]))
+    return lessons
+
+
+def build(lessons, max_size=MAX_PACK):
+    if not 0 < len(lessons) <= 255:
+        raise LessonError('o pacote precisa de 1 a 255 aulas')
+
+    index = b''
+    cells = b''
+    first = 0
+    for lesson in lessons:
+        index += INDEX.pack(lesson['name'].encode('utf-8'), first, len(lesson['cells']))
+        for c in lesson['cells']:
+            cells += CELL.pack(c['letter'].encode(), (c['answer'] or '\0').encode(),
+                               (c['options'] or '\0\0\0').encode(), c['flags'], c['time_ms'])
+        first += len(lesson['cells'])
+
+    if first > 0xFFFF:
+        raise LessonError('celas demais no pacote')
+    body = index + cells
+    total = HEADER.size + len(body)
+    if total > max_size:
+        raise LessonError('pacote de {} bytes excede a região de {} bytes'.format(total, max_size))
+    header = HEADER.pack(MAGIC, VERSION, len(lessons), first, total, zlib.crc32(body) & 0xFFFFFFFF)
+    return header + body
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compila aulas em texto para pacote binário')
+    parser.add_argument('input', help='arquivo de aula em texto')
+    parser.add_argument('-o', '--output', required=True, help='pacote binário de saída')
+    parser.add_argument('--max-size', type=lambda v: int(v, 0), default=MAX_PACK,
+                        help='tamanho da região de aulas na flash (BITBRAILLE_LESSON_FLASH_SIZE, padrão {})'.format(MAX_PACK))
+    args = parser.parse_args()
+
+    with open(args.input, encoding='utf-8') as f:
+        text = f.read()
+    try:
+        lessons = parse(text)
+        pack = build(lessons, args.max_size)
+    except LessonError as e:
+        print('{}: {}'.format(args.input, e), file=sys.stderr)
+        return 1
+
+    with open(args.output, 'wb') as f:
+        f.write(pack)
+    cells = sum(len(l['cells']) for l in lessons)
+    print('{} aulas, {} celas, {} bytes'.format(len(lessons), cells, len(pack)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
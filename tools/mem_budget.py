@@ -0,0 +1,240 @@
+#!/usr/bin/python3
+
+# Relatório de uso de RAM e flash por módulo a partir do map file do linker.
+#
+# Uso (normalmente via "make mem_report"):
+#   python3 tools/mem_budget.py build/projeto_final.elf.map --budget tools/mem_budget.json
+#   python3 tools/mem_budget.py build/projeto_final.elf.map --elf build/projeto_final.elf \
+#       --nm arm-none-eabi-nm --forbid-heap
+#   python3 tools/mem_budget.py build/projeto_final.elf.map --summary copy_to_ram \
+#       --flash-reserve 65536
+#
+# Sai com código 1 se algum orçamento for ultrapassado (--strict), se
+# houver alocação dinâmica no binário (--forbid-heap) ou se o binário
+# invadir a região reservada no fim da flash (--flash-reserve).
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# Seções de saída do linker script do RP2040 e onde elas ocupam espaço.
+# .data (inclui __not_in_flash_func/.time_critical) é copiada da flash para a RAM.
+FLASH_ONLY = {'.boot2', '.text', '.rodata', '.binary_info', '.ARM.extab', '.ARM.exidx',
+              '.flash_begin', '.flash_end', '.flashdata'}
+RAM_AND_FLASH = {'.data', '.ram_vector_table_copy', '.scratch_x', '.scratch_y'}
+RAM_ONLY = {'.bss', '.uninitialized_data', '.ram_vector_table', '.heap', '.stack_dummy',
+            '.stack1_dummy', '.stack', '.tbss'}
+
+# Agrupamento dos objetos em módulos (primeira regra que casar)
+MODULE_RULES = [
+    (re.compile(r'projeto_final\.dir/inc/([^/]+)\.c\.obj$'), r'\1'),
+    (re.compile(r'projeto_final\.dir/([^/]+)\.c\.obj$'), r'\1'),
+    (re.compile(r'/lib/lwip/'), 'lwip'),
+    (re.compile(r'/lib/cyw43-driver/'), 'cyw43'),
+    (re.compile(r'/src/rp2_common/(pico_cyw43_\w+|pico_lwip)/'), 'cyw43'),
+    (re.compile(r'/src/(?:rp2_common|common|rp2040)/((?:hardware|pico|boot)_?\w*)/'), r'sdk:\1'),
+    (re.compile(r'bs2_default|boot_stage2'), 'sdk:boot2'),
+    (re.compile(r'lib(c|m|nosys|g)(_nano)?\.a\('), 'libc'),
+    (re.compile(r'libgcc\.a\('), 'libgcc'),
+    (re.compile(r'libstdc\+\+'), 'libstdc++'),
+]
+
+HEAP_SYMBOLS = {'malloc', 'calloc', 'realloc', 'free', '_malloc_r', '_calloc_r', '_realloc_r',
+                '_free_r', '__wrap_malloc', '__wrap_calloc', '__wrap_realloc', '__wrap_free', '_sbrk'}
+
+# Seções "de flash" ligadas na SRAM (binário copy_to_ram) ocupam as duas
+RAM_START, RAM_END = 0x20000000, 0x20042000
+
+MEMORY_REGION = re.compile(r'^(\w+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)')
+FLASH_BINARY_END = re.compile(r'^\s+0x([0-9a-f]+)\s+__flash_binary_end\s*=')
+
+OUTPUT_SECTION = re.compile(r'^(\.\S+)(?:\s+0x[0-9a-f]+\s+0x[0-9a-f]+)?')
+INPUT_SECTION = re.compile(r'^ (\S+)?\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$')
+
+
+def module_of(path):
+    path = path.replace('\\', '/')
+    for rule, name in MODULE_RULES:
+        m = rule.search(path)
+        if m:
+            return m.expand(name) if '\\' in name else name
+    return os.path.basename(path.split('(')[0])
+
+
+def parse_map(path):
+    usage = {}
+    in_memory_map = False
+    current = None
+    pending = None   # nome de seção de entrada longo (quebrado em duas linhas)
+
+    with open(path, errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\n')
+            if line.startswith('Linker script and memory map'):
+                in_memory_map = True
+                continue
+            if not in_memory_map:
+                continue
+
+            if line and not line.startswith(' '):
+                m = OUTPUT_SECTION.match(line)
+                current = m.group(1) if m else None
+                pending = None
+                continue
+
+            m = INPUT_SECTION.match(line)
+            if m is None:
+                stripped = line.strip()
+                pending = stripped if stripped.startswith('.') and ' ' not in stripped else None
+                continue
+
+            addr, size, obj = int(m.group(2), 16), int(m.group(3), 16), m.group(4).strip()
+            name = m.group(1) or pending or ''
+            pending = None
+            if size == 0 or current is None or addr == 0:
+                continue
+            if not (obj.endswith('.obj') or obj.endswith('.o') or obj.endswith(')')):
+                continue
+
+            in_ram = RAM_START <= addr < RAM_END
+            ram_and_flash = current in RAM_AND_FLASH or (current in FLASH_ONLY and in_ram)
+            ram = size if current in RAM_ONLY or ram_and_flash else 0
+            flash = size if current in FLASH_ONLY or ram_and_flash else 0
+            if ram == 0 and flash == 0:
+                continue
+
+            mod = usage.setdefault(module_of(obj), {'ram': 0, 'flash': 0, 'ram_code': 0})
+            mod['ram'] += ram
+            mod['flash'] += flash
+            # Código executado da SRAM (__not_in_flash_func, .time_critical ou copy_to_ram)
+            if in_ram and (name.startswith('.text') or name.startswith('.time_critical')):
+                mod['ram_code'] += size
+    return usage
+
+
+# Fim da região FLASH (Memory Configuration) e fim da imagem gravada
+def flash_layout(path):
+    flash_end = binary_end = None
+    in_config = False
+    with open(path, errors='replace') as f:
+        for line in f:
+            if line.startswith('Memory Configuration'):
+                in_config = True
+            elif line.startswith('Linker script and memory map'):
+                in_config = False
+            elif in_config:
+                m = MEMORY_REGION.match(line)
+                if m and m.group(1) == 'FLASH':
+                    flash_end = int(m.group(2), 16) + int(m.group(3), 16)
+            else:
+                m = FLASH_BINARY_END.match(line)
+                if m:
+                    binary_end = int(m.group(1), 16)
+    return flash_end, binary_end
+
+
+def check_flash_reserve(path, reserve):
+    flash_end, binary_end = flash_layout(path)
+    if flash_end is None or binary_end is None:
+        print('Map sem região FLASH ou __flash_binary_end', file=sys.stderr)
+        return 1
+    limit = flash_end - reserve
+    if binary_end > limit:
+        print('Binário termina em 0x{:08x}, dentro dos {} bytes reservados a partir de 0x{:08x}'.format(
+            binary_end, reserve, limit), file=sys.stderr)
+        return 1
+    return 0
+
+
+def heap_symbols(elf, nm):
+    out = subprocess.run([nm, '--defined-only', elf], check=True, capture_output=True, text=True).stdout
+    found = set()
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) == 3 and parts[1] in 'Tt' and parts[2] in HEAP_SYMBOLS:
+            found.add(parts[2])
+    return sorted(found)
+
+
+def fmt(n):
+    return '{:>10}'.format(n)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Uso de RAM/flash por módulo contra orçamentos')
+    parser.add_argument('map', help='map file gerado pelo linker (projeto_final.elf.map)')
+    parser.add_argument('--budget', help='JSON com orçamentos (tools/mem_budget.json)')
+    parser.add_argument('--strict', action='store_true', help='falha se algum orçamento estourar')
+    parser.add_argument('--elf', help='ELF final, para checar alocação dinâmica')
+    parser.add_argument('--nm', default='arm-none-eabi-nm')
+    parser.add_argument('--forbid-heap', action='store_true', help='falha se malloc/free estiverem no binário')
+    parser.add_argument('--summary', metavar='VARIANTE', help='só uma linha com os totais (pós-build)')
+    parser.add_argument('--flash-reserve', type=int, metavar='BYTES',
+                        help='falha se o binário ocupar os últimos BYTES da flash')
+    args = parser.parse_args()
+
+    reserve_status = check_flash_reserve(args.map, args.flash_reserve) if args.flash_reserve else 0
+
+    usage = parse_map(args.map)
+    if args.summary:
+        total = {k: sum(m[k] for m in usage.values()) for k in ('ram', 'flash', 'ram_code')}
+        print('[{}] flash {} bytes, RAM {} bytes, codigo na SRAM {} bytes'.format(
+            args.summary, total['flash'], total['ram'], total['ram_code']))
+        return reserve_status
+
+    budget = {}
+    if args.budget:
+        with open(args.budget) as f:
+            budget = json.load(f)
+    limits = budget.get('modules', {})
+    total_limit = budget.get('total', {})
+
+    over = []
+    print('{:<24}{:>10}{:>10}{:>10}{:>10}  (bytes)'.format('modulo', 'RAM', 'orc.RAM', 'flash', 'orc.flash'))
+    for name, mod in sorted(usage.items(), key=lambda kv: -(kv[1]['ram'] + kv[1]['flash'])):
+        lim = limits.get(name, {})
+        flags = ''
+        for kind in ('ram', 'flash'):
+            if kind in lim and mod[kind] > lim[kind]:
+                flags += ' ' + kind.upper() + '!'
+                over.append('{} {}'.format(name, kind))
+        print('{:<24}{}{}{}{}{}'.format(name[:23], fmt(mod['ram']),
+                                        fmt(lim['ram']) if 'ram' in lim else fmt('-'),
+                                        fmt(mod['flash']),
+                                        fmt(lim['flash']) if 'flash' in lim else fmt('-'),
+                                        flags))
+
+    total = {k: sum(m[k] for m in usage.values()) for k in ('ram', 'flash')}
+    print('-' * 64)
+    for kind in ('ram', 'flash'):
+        line = '{:<24}{}'.format('total ' + kind, fmt(total[kind]))
+        if kind in total_limit:
+            pct = 100.0 * total[kind] / total_limit[kind]
+            line += ' de {} ({:.1f}%)'.format(fmt(total_limit[kind]).strip(), pct)
+            if total[kind] > total_limit[kind]:
+                over.append('total ' + kind)
+        print(line)
+
+    status = 0
+    if over:
+        print('\nOrçamento estourado: ' + ', '.join(over), file=sys.stderr)
+        if args.strict:
+            status = 1
+
+    if args.forbid_heap:
+        if not args.elf:
+            parser.error('--forbid-heap precisa de --elf')
+        found = heap_symbols(args.elf, args.nm)
+        if found:
+            print('\nAlocação dinâmica presente no binário: ' + ', '.join(found), file=sys.stderr)
+            status = 1
+        else:
+            print('\nSem alocação dinâmica no binário.')
+    return status or reserve_status
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/python3
+
+# Empacota clipes de voz (voice/A.wav ... voice/Z.wav) em IMA-ADPCM
+# e gera o arquivo C com a tabela voice_clips[] (inc/voice.h).
+#
+# Os WAV devem ser mono, PCM de 16 bits, entre 8000 e 16000 Hz.
+# O nome do arquivo (sem extensão) é a letra do clipe.
+#
+# Uso (chamado pelo CMake):
+#   python3 tools/pack_voice.py -o voice_clips.c voice/*.wav
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def decode_nibble(state, nibble):
+    predictor, index = state
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+    predictor = predictor - diff if nibble & 8 else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX_TABLE[nibble]))
+    return (predictor, index)
+
+
+def encode(samples):
+    """IMA-ADPCM a partir de predictor=0, index=0 (o mesmo estado inicial do firmware)."""
+    state = (0, 0)
+    nibbles = []
+    for s in samples:
+        predictor, index = state
+        step = STEP_TABLE[index]
+        diff = s - predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+        if diff >= step >> 1:
+            nibble |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            nibble |= 1
+        # Avança com o decodificador para não acumular erro
+        state = decode_nibble(state, nibble)
+        nibbles.append(nibble)
+
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+def read_wav(path):
+    with wave.open(path, 'rb') as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 2:
+            raise ValueError('{}: use WAV mono de 16 bits'.format(path))
+        rate = w.getframerate()
+        if not 8000 <= rate <= 16000:
+            raise ValueError('{}: taxa de {} Hz fora de 8000..16000'.format(path, rate))
+        frames = w.readframes(w.getnframes())
+    return rate, list(struct.unpack('<{}h'.format(len(frames) // 2), frames))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Gera voice_clips.c a partir de voice/*.wav')
+    parser.add_argument('wavs', nargs='*', help='arquivos A.wav ... Z.wav')
+    parser.add_argument('-o', '--output', required=True, help='arquivo C de saída')
+    args = parser.parse_args()
+
+    clips = []
+    for path in sorted(args.wavs):
+        letter = os.path.splitext(os.path.basename(path))[0].upper()
+        if len(letter) != 1 or not 'A' <= letter <= 'Z':
+            print('ignorando {} (o nome deve ser a letra)'.format(path), file=sys.stderr)
+            continue
+        try:
+            rate, samples = read_wav(path)
+        except ValueError as e:
+            print(e, file=sys.stderr)
+            return 1
+        clips.append((letter, rate, len(samples), encode(samples)))
+
+    with open(args.output, 'w') as out:
+        out.write('// Gerado por tools/pack_voice.py - não edite\n\n')
+        out.write('#include "inc/voice.h"\n\n')
+        for letter, rate, count, data in clips:
+            out.write('static const uint8_t voice_data_{}[] = {{\n'.format(letter))
+            for i in range(0, len(data), 16):
+                out.write('\t' + ', '.join('0x{:02x}'.format(b) for b in data[i:i + 16]) + ',\n')
+            out.write('};\n\n')
+
+        out.write('const voice_clip_t voice_clips[] = {\n')
+        for letter, rate, count, data in clips:
+            out.write("\t{{'{0}', {1}, {2}, voice_data_{0}}},\n".format(letter, rate, count))
+        if not clips:
+            out.write("\t{0, 0, 0, 0},\n")
+        out.write('};\n\n')
+        out.write('const size_t voice_clip_count = {};\n'.format(len(clips)))
+
+    total = sum(len(c[3]) for c in clips)
+    print('{} clipes de voz, {} bytes de ADPCM'.format(len(clips), total))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
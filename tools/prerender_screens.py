@@ -0,0 +1,175 @@
+#!/usr/bin/python3
+
+# Pré-renderiza no build as telas fixas do OLED e o atlas de glifos a
+# partir de inc/font.h, no mesmo formato do framebuffer (em páginas:
+# byte [1 + página * largura + x], bit y & 7, byte 0 = 0x40).
+#
+# Gera:
+#   oled_assets.c  -> ssd1306_glyph_atlas/ssd1306_glyph_mask (inc/ssd1306_glyph.h),
+#                     na SRAM como o ssd1306_draw_char que os lê, e as telas
+#                     oled_screen_<nome>[], const na flash (copiadas uma vez)
+#   oled_screens.h -> declarações das telas
+#
+# Uso (chamado pelo CMake):
+#   python3 tools/prerender_screens.py --font inc/font.h --width 128 --height 64 -o build/
+
+import argparse
+import os
+import re
+import sys
+
+# Telas fixas: (texto, x, y) desenhados como ssd1306_draw_string sobre a tela apagada.
+# O que muda em tempo de execução (letra, opções, tempos, IP) é composto com os glifos,
+# nas linhas OLED_*_Y de projeto_final.c.
+SCREENS = {
+    'display_on': [('Display ON', 5, 5)],
+    'wifi_search': [('Procurando', 28, 20), ('   WIFI...', 28, 30)],
+    'wifi_on': [('WIFI ON!', 40, 10)],
+    'bitbraile': [('BitBraile', 30, 25)],
+    'letra': [('Letra:', 5, 0)],
+    'correto': [('Correto!', 35, 25)],
+    'errado': [('Errado!', 35, 25)],
+    'fim_aula': [('Fim da aula', 20, 20)],
+}
+
+# Em 32 px cabem 4 linhas de 8 px: título em cima, detalhe na linha de baixo
+SCREENS_32 = {
+    'wifi_search': [('Procurando', 28, 8), ('   WIFI...', 28, 16)],
+    'wifi_on': [('WIFI ON!', 40, 4)],
+    'bitbraile': [('BitBraile', 30, 12)],
+    'correto': [('Correto!', 35, 4)],
+    'errado': [('Errado!', 35, 4)],
+    'fim_aula': [('Fim da aula', 20, 4)],
+}
+
+GLYPH_FIRST = 0x20
+GLYPH_COUNT = 96
+
+
+def load_font(path):
+    with open(path) as f:
+        text = f.read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    body = re.sub(r'//[^\n]*', '', body)
+    return [int(v, 16) for v in re.findall(r'0x[0-9a-fA-F]+', body)]
+
+
+# Mesmo índice de ssd1306_draw_char original (None = não suportado)
+def font_index(c):
+    if 'A' <= c <= 'Z':
+        return (ord(c) - ord('A') + 11) * 8
+    if '0' <= c <= '9':
+        return (ord(c) - ord('0') + 1) * 8
+    if 'a' <= c <= 'z':
+        return (ord(c) - ord('a') + 37) * 8
+    if '!' <= c <= '/':
+        return (ord(c) - ord('!') + 63) * 8
+    return None
+
+
+class Frame:
+    def __init__(self, width, height):
+        self.width = width
+        self.height = height
+        self.buf = bytearray(width * (height // 8) + 1)
+        self.buf[0] = 0x40
+
+    def pixel(self, x, y, value):
+        if x >= self.width or y >= self.height:
+            return
+        index = (y >> 3) * self.width + x + 1
+        if value:
+            self.buf[index] |= 1 << (y & 7)
+        else:
+            self.buf[index] &= ~(1 << (y & 7)) & 0xFF
+
+    def draw_char(self, font, c, x, y):
+        index = font_index(c)
+        if index is None:
+            return
+        for i in range(8):
+            line = font[index + i]
+            for j in range(8):
+                self.pixel(x + i, y + j, line & (1 << j))
+
+    # Mesma quebra de linha de ssd1306_draw_string
+    def draw_string(self, font, s, x, y):
+        for c in s:
+            self.draw_char(font, c, x, y)
+            x += 8
+            if x + 8 >= self.width:
+                x = 0
+                y += 8
+            if y + 8 > self.height:
+                break
+
+
+def c_bytes(data, indent='  ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x{:02x}'.format(b) for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Telas do OLED e atlas de glifos pré-renderizados.')
+    parser.add_argument('--font', required=True, help='inc/font.h')
+    parser.add_argument('--width', type=int, default=128)
+    parser.add_argument('--height', type=int, default=64)
+    parser.add_argument('-o', '--outdir', required=True)
+    args = parser.parse_args()
+
+    if args.height % 8:
+        parser.error('altura deve ser múltipla de 8')
+    font = load_font(args.font)
+
+    atlas = bytearray(GLYPH_COUNT * 8)
+    mask = [0, 0, 0]
+    for code in range(GLYPH_COUNT):
+        index = font_index(chr(GLYPH_FIRST + code))
+        if index is None or index + 8 > len(font):
+            continue
+        atlas[code * 8:code * 8 + 8] = bytes(font[index:index + 8])
+        mask[code >> 5] |= 1 << (code & 31)
+
+    out = ['// Gerado por tools/prerender_screens.py a partir de inc/font.h. Não editar.',
+           '#include <stdint.h>',
+           '// Fora do SDK (tools/glyph_check.c) o atlas é um const comum',
+           '#if defined(__has_include)', '#if __has_include("pico.h")', '#include "pico.h"', '#endif', '#endif',
+           '#ifndef __not_in_flash', '#define __not_in_flash(group)', '#endif', '',
+           '// Glifos de 8x8 indexados por (c - 0x20): 8 colunas, bit j = linha j',
+           'const uint8_t __not_in_flash("oled") ssd1306_glyph_atlas[{}][8] = {{'.format(GLYPH_COUNT)]
+    for code in range(GLYPH_COUNT):
+        out.append('  {{ {} }}, // {}'.format(', '.join('0x{:02x}'.format(b) for b in atlas[code * 8:code * 8 + 8]),
+                                            repr(chr(GLYPH_FIRST + code))))
+    out += ['};', '',
+           '// Caracteres com glifo (os demais não desenham nada, como antes)',
+           'const uint32_t __not_in_flash("oled") ssd1306_glyph_mask[3] = {{ 0x{:08x}, 0x{:08x}, 0x{:08x} }};'.format(*mask), '']
+
+    header = ['// Gerado por tools/prerender_screens.py. Não editar.',
+              '#ifndef OLED_SCREENS_H', '#define OLED_SCREENS_H', '', '#include <stdint.h>', '',
+              '// Telas {}x{} prontas para ssd1306_blit()'.format(args.width, args.height)]
+    screens = dict(SCREENS)
+    if args.height == 32:
+        screens.update(SCREENS_32)
+    for name, texts in screens.items():
+        frame = Frame(args.width, args.height)
+        for text, x, y in texts:
+            frame.draw_string(font, text, x, y)
+        out.append('const uint8_t oled_screen_{}[{}] = {{'.format(name, len(frame.buf)))
+        out.append(c_bytes(frame.buf))
+        out.append('};')
+        out.append('')
+        header.append('extern const uint8_t oled_screen_{}[];'.format(name))
+    header += ['', '#endif', '']
+
+    os.makedirs(args.outdir, exist_ok=True)
+    with open(os.path.join(args.outdir, 'oled_assets.c'), 'w') as f:
+        f.write('\n'.join(out))
+    with open(os.path.join(args.outdir, 'oled_screens.h'), 'w') as f:
+        f.write('\n'.join(header))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
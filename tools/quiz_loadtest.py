@@ -0,0 +1,177 @@
+#!/usr/bin/python3
+
+# Teste de carga do quiz remoto: simula a rajada de celulares respondendo
+# quase ao mesmo tempo e confere se nenhuma resposta se perdeu. Durante a
+# rajada, alguns clientes leem o /quiz.json sem parar (como o professor
+# acompanhando o placar) e cada leitura precisa chegar inteira.
+#
+# A placa guarda QUIZ_MAX_CLIENTS (32) respostas por rodada: além disso a
+# resposta esperada é "cheio". Nada pode se perder na rajada: conexão
+# recusada ou abortada e 503 (sem buffer livre) contam como falha.
+#
+# tools/quiz_sim.py aplica os limites de conexões e buffers da placa, mas
+# não tem Wi-Fi nem a memória do lwIP: o resultado que vale é o da placa.
+#
+# Uso:
+#   python3 tools/quiz_loadtest.py 192.168.0.50                 # 30 clientes, abre e fecha a rodada
+#   python3 tools/quiz_loadtest.py 192.168.0.50 --clients 40 --rounds 5
+#   python3 tools/quiz_sim.py & python3 tools/quiz_loadtest.py 127.0.0.1 --port 8080 --clients 40
+#
+# Sai com código 1 se alguma conexão falhar, se um /quiz.json vier
+# truncado ou se o /quiz.json final não contar todas as respostas aceitas.
+
+import argparse
+import asyncio
+import json
+import random
+import string
+import sys
+import time
+
+QUIZ_MAX_CLIENTS = 32    # inc/quiz.h
+HTTPD_CONNS = 48         # MEMP_NUM_PARALLEL_HTTPD_CONNS (lwipopts.h)
+
+
+async def http_get(host, port, path, timeout):
+    start = time.perf_counter()
+    writer = None
+    try:
+        reader, writer = await asyncio.wait_for(asyncio.open_connection(host, port), timeout)
+        writer.write('GET {} HTTP/1.0\r\nHost: {}\r\n\r\n'.format(path, host).encode())
+        raw = await asyncio.wait_for(reader.read(), timeout)
+    finally:
+        if writer is not None:
+            writer.close()
+    if not raw:
+        raise ConnectionError('conexão fechada sem resposta')
+    head, _, body = raw.partition(b'\r\n\r\n')
+    lines = head.split(b'\r\n')
+    status = lines[0]
+    if b' 200 ' not in status:
+        raise ValueError(status.decode(errors='replace'))
+    for line in lines[1:]:
+        name, _, value = line.partition(b':')
+        if name.strip().lower() == b'content-length' and int(value) != len(body):
+            raise ValueError('Content-Length {} com {} bytes'.format(int(value), len(body)))
+    return body, (time.perf_counter() - start) * 1000.0
+
+
+async def client(args, n, go, options):
+    await go.wait()
+    answer = random.choice(options)
+    path = '/quiz.cgi?id=carga{:02d}&r={}'.format(n, answer)
+    try:
+        body, ms = await http_get(args.host, args.port, path, args.timeout)
+        return body.decode(errors='replace').strip(), ms
+    except (OSError, asyncio.TimeoutError, ValueError) as e:
+        return 'falha: {}'.format(e.__class__.__name__ if not str(e) else e), None
+
+
+# Lê o /quiz.json até a rajada terminar; devolve (lidos, erros)
+async def poller(args, go, done):
+    reads, errors = 0, []
+    await go.wait()
+    while not done.is_set():
+        try:
+            body, _ = await http_get(args.host, args.port, '/quiz.json', args.timeout)
+            state = json.loads(body)
+            if not state.get('open') or not 0 <= state.get('answers', -1) <= QUIZ_MAX_CLIENTS:
+                raise ValueError('estado inesperado: {}'.format(state))
+            reads += 1
+        except (OSError, asyncio.TimeoutError, ValueError) as e:
+            errors.append('quiz.json: {}'.format(e.__class__.__name__ if not str(e) else e))
+        await asyncio.sleep(args.poll_interval)
+    return reads, errors
+
+
+async def run_round(args, letter):
+    await http_get(args.host, args.port, '/send.cgi?quiz={}'.format(letter), args.timeout)
+    body, _ = await http_get(args.host, args.port, '/quiz.json', args.timeout)
+    state = json.loads(body)
+    if not state.get('open'):
+        raise SystemExit('a rodada não abriu: {}'.format(state))
+    options = state['options']
+
+    # Todos os clientes conectam juntos quando o evento é liberado
+    go = asyncio.Event()
+    done = asyncio.Event()
+    tasks = [asyncio.create_task(client(args, n, go, options)) for n in range(args.clients)]
+    polls = [asyncio.create_task(poller(args, go, done)) for _ in range(args.pollers)]
+    await asyncio.sleep(0.05)
+    start = time.perf_counter()
+    go.set()
+    results = await asyncio.gather(*tasks)
+    burst_ms = (time.perf_counter() - start) * 1000.0
+    done.set()
+    polled = await asyncio.gather(*polls)
+
+    await http_get(args.host, args.port, '/send.cgi?quiz=0', args.timeout)
+    body, _ = await http_get(args.host, args.port, '/quiz.json', args.timeout)
+    final = json.loads(body)
+    return results, burst_ms, polled, final
+
+
+def report(round_no, results, burst_ms, polled, final):
+    ok = [ms for text, ms in results if text == 'ok']
+    full = [text for text, ms in results if text == 'cheio']
+    failed = [text for text, ms in results if ms is None]
+    other = [text for text, ms in results if ms is not None and text not in ('ok', 'cheio')]
+    lat = sorted(ok)
+    # Além de QUIZ_MAX_CLIENTS a placa responde "cheio", e só nesse caso
+    expected_ok = min(len(results), QUIZ_MAX_CLIENTS)
+    if not failed and not other and len(ok) != expected_ok:
+        other.append('{} aceitas, esperadas {}'.format(len(ok), expected_ok))
+
+    print('rodada {}: {} aceitas, {} cheio, {} falhas, {} outras respostas, rajada em {:.0f} ms'.format(
+        round_no, len(ok), len(full), len(failed), len(other), burst_ms))
+    if lat:
+        print('  latência p50 {:.1f} ms, p95 {:.1f} ms, máx {:.1f} ms'.format(
+            lat[len(lat) // 2], lat[min(len(lat) - 1, int(len(lat) * 0.95))], lat[-1]))
+    for text in sorted(set(failed + other)):
+        print('  {} x {}'.format((failed + other).count(text), text))
+
+    reads = sum(r for r, _ in polled)
+    poll_errors = [e for _, errs in polled for e in errs]
+    if polled:
+        print('  /quiz.json durante a rajada: {} leituras, {} com erro'.format(reads, len(poll_errors)))
+        for text in sorted(set(poll_errors)):
+            print('  {} x {}'.format(poll_errors.count(text), text))
+        if reads == 0:
+            poll_errors.append('nenhuma leitura')
+
+    counted = final.get('answers', -1)
+    print('  /quiz.json: {} respostas, {} certas, mais rápido: {}'.format(
+        counted, final.get('correct'), (final.get('ranking') or [{}])[0].get('id', '-')))
+    return not failed and not other and not poll_errors and counted == len(ok)
+
+
+async def main_async(args):
+    good = True
+    for r in range(args.rounds):
+        letter = random.choice(string.ascii_uppercase)
+        results, burst_ms, polled, final = await run_round(args, letter)
+        good = report(r + 1, results, burst_ms, polled, final) and good
+        if r + 1 < args.rounds:
+            await asyncio.sleep(args.pause)
+    return 0 if good else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Rajada de respostas no quiz remoto do BitBraille.')
+    parser.add_argument('host', help='IP da placa')
+    parser.add_argument('--port', type=int, default=80)
+    parser.add_argument('--clients', type=int, default=30, help='celulares simulados (padrão 30)')
+    parser.add_argument('--pollers', type=int, default=2, help='leitores do /quiz.json durante a rajada')
+    parser.add_argument('--poll-interval', type=float, default=0.02, help='intervalo entre leituras em s')
+    parser.add_argument('--rounds', type=int, default=1, help='rodadas seguidas')
+    parser.add_argument('--pause', type=float, default=1.0, help='pausa entre rodadas em s')
+    parser.add_argument('--timeout', type=float, default=5.0, help='tempo limite por requisição em s')
+    args = parser.parse_args()
+    if args.clients + args.pollers > HTTPD_CONNS:
+        print('aviso: {} conexões simultâneas passam de MEMP_NUM_PARALLEL_HTTPD_CONNS ({}); '
+              'a placa aborta as excedentes'.format(args.clients + args.pollers, HTTPD_CONNS), file=sys.stderr)
+    return asyncio.run(main_async(args))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
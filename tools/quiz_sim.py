@@ -0,0 +1,175 @@
+#!/usr/bin/python3
+
+# Placa BitBraille simulada para rodar o tools/quiz_loadtest.py sem
+# hardware: /send.cgi?quiz=X, /quiz.cgi e /quiz.json seguem inc/quiz.c
+# (QUIZ_MAX_CLIENTS, "cheio", ranking só com a rodada encerrada).
+#
+# Os limites da placa também valem aqui:
+#   - conexões simultâneas: MEMP_NUM_PARALLEL_HTTPD_CONNS (lwipopts.h); sem
+#     estado livre o httpd aborta a conexão, e aqui ela é fechada com RST.
+#     MEMP_NUM_TCP_PCB é maior e recicla os PCBs em TIME_WAIT, então o
+#     limite que vale na rajada é o do httpd;
+#   - buffers das respostas geradas (projeto_final.c): 1 grande (trace,
+#     lessons, rec) e HTTP_SMALL_SLOTS pequenos (/quiz.json, /status.json,
+#     /mirror.bin), presos até o envio terminar; sem buffer livre, 503.
+#
+# Não substitui o teste na placa: não há Wi-Fi, MEM_SIZE nem segmentos TCP.
+#
+# Uso:
+#   python3 tools/quiz_sim.py --port 8080
+#   python3 tools/quiz_loadtest.py 127.0.0.1 --port 8080 --clients 40 --rounds 5
+
+import argparse
+import asyncio
+import json
+import random
+import string
+import sys
+import time
+import urllib.parse
+
+QUIZ_MAX_CLIENTS = 32    # inc/quiz.h
+QUIZ_ID_LEN = 16
+HTTP_SMALL_SLOTS = 8     # projeto_final.c
+HTTPD_CONNS = 48         # MEMP_NUM_PARALLEL_HTTPD_CONNS (lwipopts.h)
+LARGE_FILES = ('/trace.bin', '/lessons.json', '/rec.bin')
+ID_CHARS = set(string.ascii_letters + string.digits + '-_')
+
+
+class SimQuiz:
+    def __init__(self, args):
+        self.args = args
+        self.open = False
+        self.round = 0
+        self.letter = ''
+        self.options = ''
+        self.start = 0.0
+        self.entries = []     # (id, resposta, certa, ms), na ordem de chegada
+        self.slots = HTTP_SMALL_SLOTS
+        self.large_free = True
+        self.conns = 0
+        self.resets = 0
+        self.busy = 0
+
+    def start_round(self, letter):
+        self.open = True
+        self.round += 1
+        self.letter = letter.upper()
+        wrong = random.sample([c for c in string.ascii_uppercase if c != self.letter], 2)
+        options = [self.letter] + wrong
+        random.shuffle(options)
+        self.options = ''.join(options)
+        self.start = time.monotonic()
+        self.entries = []
+
+    # Mesmos casos de quiz_answer(), mesmos arquivos de quiz_cgi_handler()
+    def answer(self, ident, r):
+        if not self.open:
+            return 'fechado'
+        if not ident or len(ident) >= QUIZ_ID_LEN or len(r) < 1 or not r[0].isalpha() \
+                or not set(ident) <= ID_CHARS:
+            return 'invalida'
+        if any(e[0] == ident for e in self.entries):
+            return 'repetida'
+        if len(self.entries) >= QUIZ_MAX_CLIENTS:
+            return 'cheio'
+        r = r[0].upper()
+        self.entries.append((ident, r, r == self.letter, int((time.monotonic() - self.start) * 1000)))
+        return 'ok'
+
+    # Mesmo formato de quiz_render_json()
+    def render(self):
+        state = {'open': self.open, 'round': self.round, 'options': self.options,
+                 'answers': len(self.entries), 'correct': sum(1 for e in self.entries if e[2])}
+        if not self.open and self.round > 0:
+            state['letter'] = self.letter
+            state['ranking'] = [{'id': e[0], 'ms': e[3]} for e in self.entries if e[2]]
+            state['wrong'] = [{'id': e[0], 'r': e[1], 'ms': e[3]} for e in self.entries if not e[2]]
+        return json.dumps(state, separators=(',', ':')).encode()
+
+    async def handle(self, reader, writer):
+        # Sem estado do httpd: http_accept devolve ERR_MEM e o lwIP aborta
+        if self.conns >= HTTPD_CONNS:
+            self.resets += 1
+            writer.transport.abort()
+            return
+        self.conns += 1
+        slot = None
+        try:
+            request = await reader.readuntil(b'\r\n\r\n')
+            await asyncio.sleep(random.uniform(self.args.min_latency, self.args.max_latency) / 1000.0)
+            path = request.split(b' ', 2)[1].decode(errors='replace') if request.count(b' ') >= 2 else ''
+            url = urllib.parse.urlparse(path)
+            query = dict(urllib.parse.parse_qsl(url.query))
+            head = 'HTTP/1.0 200 OK\r\nContent-Type: {}\r\nContent-Length: {}\r\n\r\n'
+            kind = 'text/plain'
+            if url.path == '/send.cgi' and 'quiz' in query:
+                if query['quiz'][:1].isalpha():
+                    self.start_round(query['quiz'][0])
+                else:
+                    self.open = False
+                    print('rodada {}: {} conexões abortadas (RST), {} respostas 503'.format(
+                        self.round, self.resets, self.busy), file=sys.stderr)
+                    self.resets = self.busy = 0
+                body = b'ok'
+            elif url.path == '/quiz.cgi':
+                body = self.answer(query.get('id', ''), query.get('r', '')).encode()
+            elif url.path == '/quiz.json' or url.path in LARGE_FILES:
+                large = url.path in LARGE_FILES
+                if (large and not self.large_free) or (not large and self.slots == 0):
+                    self.busy += 1
+                    body = b''
+                    head = 'HTTP/1.0 503 Service Unavailable\r\nRetry-After: 1\r\nContent-Length: {1}\r\n\r\n'
+                else:
+                    # O buffer fica ocupado até o envio terminar (fs_close_custom)
+                    slot = 'large' if large else 'small'
+                    if large:
+                        self.large_free = False
+                        body = b'{}'
+                    else:
+                        self.slots -= 1
+                        body = self.render()
+                    kind = 'application/json'
+            else:
+                body = b'<html><body><h2>404 - Page not found</h2></body></html>'
+                head = 'HTTP/1.0 404 File not found\r\nContent-Type: {}\r\nContent-Length: {}\r\n\r\n'
+                kind = 'text/html'
+            writer.write(head.format(kind, len(body)).encode() + body)
+            await writer.drain()
+            if slot:
+                await asyncio.sleep(random.uniform(self.args.min_latency, self.args.max_latency) / 1000.0)
+        except (asyncio.IncompleteReadError, ConnectionError):
+            pass
+        finally:
+            if slot == 'large':
+                self.large_free = True
+            elif slot == 'small':
+                self.slots += 1
+            self.conns -= 1
+            writer.close()
+
+
+async def run(args):
+    quiz = SimQuiz(args)
+    server = await asyncio.start_server(quiz.handle, args.host, args.port)
+    print('quiz simulado em {}:{}'.format(args.host, args.port), file=sys.stderr)
+    await server.serve_forever()
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Placa BitBraille simulada (quiz remoto).')
+    parser.add_argument('--host', default='127.0.0.1')
+    parser.add_argument('--port', type=int, default=8080)
+    parser.add_argument('--min-latency', type=float, default=2.0, help='latência mínima em ms')
+    parser.add_argument('--max-latency', type=float, default=30.0, help='latência máxima em ms')
+    args = parser.parse_args()
+
+    try:
+        asyncio.run(run(args))
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,291 @@
+// Reprodução de gravações de entrada no PC, com o mesmo código da placa
+// (inc/input_record.c e inc/joystick.c)
+//
+// Simula o loop principal com relógio virtual e a mesma seleção de opções
+// do firmware: "letra" pelo CGI mostra as opções, o joystick as percorre,
+// o botão B responde e o A volta às opções. O joystick é avaliado em cada
+// amostra gravada, no instante dela, como em update_replay().
+//
+// Duas conferências das decisões (opção escolhida e resposta, com o
+// instante gravado):
+//   - reprodução em 1x contra as decisões tomadas ao vivo, gravadas pela
+//     placa junto com as entradas (INPUT_DECISION, versão 2);
+//   - reprodução na velocidade pedida contra a de 1x.
+//
+// Compilação e uso:
+//   cc -O2 -Iinc -o replay_host tools/replay_host.c inc/input_record.c inc/joystick.c
+//   curl -o sessao.bin http://<ip>/rec.bin
+//   ./replay_host sessao.bin 400 10      # 4x mais rápido, loop de 10 ms
+//   ./replay_host - 400                  # sessão sintética, sem placa
+//
+// Sai com código 1 se alguma das conferências falhar.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "input_record.h"
+#include "joystick.h"
+
+#define MAX_FILE (64 * 1024)
+#define MAX_DECISIONS 4096
+
+// Mesmos valores de projeto_final.c e inc/buttons.h
+#define BTN_A             5
+#define BTN_B             6
+#define BUTTON_PRESS      0
+#define LOOP_PERIOD_MS    10
+#define REPLAY_MAX_STEPS  100
+
+typedef struct {
+  uint64_t t_us;      // tempo gravado
+  char kind;          // 'o' = opção selecionada, 'r' = resposta
+  int option;
+} decision_t;
+
+typedef struct {
+  bool has_letter;
+  bool showing_feedback;
+  int selected;
+  joystick_gate_t gate;
+  decision_t *out;
+  size_t count;
+  size_t max;
+  bool verbose;
+} session_t;
+
+static void decide(session_t *s, uint64_t t_us, char kind, int option) {
+  if (s->verbose)
+    printf("%12llu  %s %d\n", (unsigned long long) t_us, kind == 'o' ? "opcao   " : "resposta", option);
+  if (s->count < s->max)
+    s->out[s->count] = (decision_t) { t_us, kind, option };
+  s->count++;
+}
+
+// joystick_step() do firmware: devolve true se a opção mudou
+static bool joystick_step(session_t *s, uint64_t t_us, uint16_t raw_x) {
+  int next = joystick_select(&s->gate, t_us, raw_x, s->selected, 3);
+  if (next < 0)
+    return false;
+  s->selected = next;
+  decide(s, t_us, 'o', next);
+  return true;
+}
+
+// Mesma reação do firmware a cada evento gravado
+static void deliver(session_t *s, const input_event_t *ev) {
+  if (ev->type == INPUT_ADC) {
+    if (s->has_letter && !s->showing_feedback)
+      joystick_step(s, ev->t_us, ev->adc);
+  } else if (ev->type == INPUT_BUTTON && ev->button.event == BUTTON_PRESS) {
+    if (ev->button.gpio == BTN_A && s->showing_feedback) {
+      s->has_letter = true;
+      s->showing_feedback = false;
+    } else if (ev->button.gpio == BTN_B && s->has_letter) {
+      decide(s, ev->t_us, 'r', s->selected);
+      s->showing_feedback = true;
+      s->has_letter = false;
+    }
+  } else if (ev->type == INPUT_CGI) {
+    if (strcmp(ev->cgi.param, "letra") == 0 && strlen(ev->cgi.value) == 1) {
+      s->has_letter = true;
+      s->showing_feedback = false;
+      s->selected = 0;
+    } else if (strcmp(ev->cgi.param, "quiz") == 0 && isalpha((unsigned char) ev->cgi.value[0])) {
+      s->has_letter = false;
+      s->showing_feedback = false;
+    }
+  }
+}
+
+// Reproduz a sessão como update_replay(); devolve o total de decisões.
+// As decisões gravadas ao vivo vão para live (se não for NULL).
+static size_t run(const uint8_t *buf, size_t len, uint16_t speed, uint64_t period_us,
+                  decision_t *out, size_t max, bool verbose, decision_t *live, size_t *n_live) {
+  session_t s = { .out = out, .max = max, .verbose = verbose };
+  joystick_gate_reset(&s.gate);
+
+  input_replayer_t player;
+  uint64_t now = 0;
+  if (!input_replay_start(&player, buf, len, speed, now))
+    return 0;
+
+  while (!input_replay_done(&player)) {
+    for (int step = 0; step < REPLAY_MAX_STEPS &&
+                       input_replay_tick(&player, now, LOOP_PERIOD_MS * 1000); step++) {
+      input_event_t ev;
+      while (input_replay_next(&player, &ev)) {
+        if (ev.type != INPUT_DECISION) {
+          deliver(&s, &ev);
+        } else if (live != NULL) {
+          if (*n_live < max)
+            live[*n_live] = (decision_t) { ev.t_us, ev.decision.kind, ev.decision.option };
+          (*n_live)++;
+        }
+      }
+    }
+    now += period_us;
+  }
+  return s.count;
+}
+
+// Joystick da sessão sintética: (até quando, leitura crua). Inclui os
+// movimentos pequenos que cruzam um limiar (2050 -> 2110, 1100 -> 950).
+static const struct { uint64_t until_us; uint16_t raw; } synth_adc[] = {
+  {  300000, 2048 },
+  { 2300000,  400 },     // segurado para cima: 4 movimentos
+  { 2500000, 2048 },
+  { 2800000, 3600 },     // para baixo
+  { 3000000, 2048 },
+  { 3200000,  500 },     // dentro do intervalo de 600 ms
+  { 3700000, 2050 },
+  { 3900000, 2110 },     // logo acima de JOYSTICK_THRESHOLD_DOWN
+  { 4300000, 2050 },
+  { 4500000, 1100 },
+  { 4700000,  950 },     // logo abaixo de JOYSTICK_THRESHOLD_UP
+  { 5000000, 1100 },
+  { 6500000, 2048 },
+  { 7200000, 3900 },
+  { 8000000, 2048 },
+};
+
+static const struct { uint64_t t_us; uint8_t gpio; } synth_buttons[] = {
+  { 5200000, BTN_B },
+  { 6000000, BTN_A },
+  { 8500000, BTN_B },
+};
+
+static uint16_t synth_raw(uint64_t t_us) {
+  for (size_t i = 0; i < sizeof(synth_adc) / sizeof(synth_adc[0]); i++)
+    if (t_us < synth_adc[i].until_us)
+      return synth_adc[i].raw;
+  return 2048;
+}
+
+// Grava as decisões novas da sessão, como record_decision() no firmware
+static void record_decisions(input_recorder_t *r, const session_t *s, size_t *done) {
+  for (; *done < s->count && *done < s->max; (*done)++)
+    input_record_decision(r, s->out[*done].t_us, s->out[*done].kind, (uint8_t) s->out[*done].option);
+}
+
+// Sessão de exemplo gravada como a placa grava: loop ao vivo com período
+// irregular, botões antes do joystick, e a amostra do joystick gravada
+// quando muda de zona ou quando move (read_joystick_and_select()).
+static size_t synth_session(uint8_t *buf, size_t cap) {
+  static decision_t live[MAX_DECISIONS];
+  session_t s = { .out = live, .max = MAX_DECISIONS };
+  joystick_gate_reset(&s.gate);
+
+  uint64_t now = 1000000;       // time_us_64() ao começar a gravar
+  uint32_t lcg = 1;
+  size_t done = 0, next_button = 0;
+  int last_zone = -1;
+  input_recorder_t r;
+  input_record_start(&r, buf, cap, now);
+
+  input_event_t ev = { .type = INPUT_CGI, .t_us = now };
+  strcpy(ev.cgi.param, "letra");
+  strcpy(ev.cgi.value, "A");
+  input_record_cgi(&r, now, ev.cgi.param, ev.cgi.value);
+  deliver(&s, &ev);
+
+  while (now < 1000000 + 9000000) {
+    // Loop de 10 ms mais 0..4 ms de trabalho (OLED, Wi-Fi)
+    lcg = lcg * 1103515245u + 12345u;
+    now += LOOP_PERIOD_MS * 1000 + (lcg >> 16) % 4000;
+
+    while (next_button < sizeof(synth_buttons) / sizeof(synth_buttons[0]) &&
+           1000000 + synth_buttons[next_button].t_us <= now) {
+      ev = (input_event_t) { .type = INPUT_BUTTON, .t_us = 1000000 + synth_buttons[next_button].t_us };
+      ev.button.gpio = synth_buttons[next_button].gpio;
+      ev.button.event = BUTTON_PRESS;
+      input_record_button(&r, ev.t_us, ev.button.gpio, ev.button.event);
+      deliver(&s, &ev);
+      record_decisions(&r, &s, &done);
+      next_button++;
+    }
+
+    if (s.has_letter && !s.showing_feedback) {
+      uint16_t raw_x = synth_raw(now - 1000000);
+      bool moved = joystick_step(&s, now, raw_x);
+      int zone = joystick_zone(raw_x);
+      if (moved || zone != last_zone) {
+        input_record_adc(&r, now, raw_x);
+        last_zone = zone;
+      }
+      record_decisions(&r, &s, &done);
+    }
+  }
+  return input_record_stop(&r);
+}
+
+// Compara duas listas de decisões; imprime a primeira diferença
+static bool same_decisions(const decision_t *a, size_t n_a, const char *name_a,
+                           const decision_t *b, size_t n_b, const char *name_b) {
+  size_t n = n_a < n_b ? n_a : n_b;
+  if (n > MAX_DECISIONS)
+    n = MAX_DECISIONS;
+  for (size_t i = 0; i < n; i++) {
+    if (a[i].t_us != b[i].t_us || a[i].kind != b[i].kind || a[i].option != b[i].option) {
+      printf("diverge na decisao %zu: %s %c%d em %llu us, %s %c%d em %llu us\n", i,
+             name_a, a[i].kind, a[i].option, (unsigned long long) a[i].t_us,
+             name_b, b[i].kind, b[i].option, (unsigned long long) b[i].t_us);
+      return false;
+    }
+  }
+  if (n_a != n_b) {
+    printf("%zu decisoes em %s, %zu em %s\n", n_a, name_a, n_b, name_b);
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "uso: %s gravacao.bin|- [velocidade_pct=100] [periodo_loop_ms=10]\n", argv[0]);
+    return 1;
+  }
+  uint16_t speed = argc > 2 ? (uint16_t) atoi(argv[2]) : 100;
+  uint64_t period_us = (argc > 3 ? (uint64_t) atoi(argv[3]) : 10) * 1000;
+  if (period_us == 0)
+    period_us = 1;
+
+  static uint8_t buf[MAX_FILE];
+  size_t len;
+  if (strcmp(argv[1], "-") == 0) {
+    len = synth_session(buf, sizeof(buf));
+  } else {
+    FILE *f = fopen(argv[1], "rb");
+    if (f == NULL) {
+      perror(argv[1]);
+      return 1;
+    }
+    len = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+  }
+
+  input_replayer_t check;
+  if (!input_replay_start(&check, buf, len, 100, 0)) {
+    fprintf(stderr, "%s: gravação inválida ou vazia\n", argv[1]);
+    return 1;
+  }
+
+  static decision_t live[MAX_DECISIONS], ref[MAX_DECISIONS], got[MAX_DECISIONS];
+  size_t n_live = 0;
+  size_t n_ref = run(buf, len, 100, LOOP_PERIOD_MS * 1000, ref, MAX_DECISIONS, false, live, &n_live);
+  printf("%12s  decisao (velocidade %u%%, loop de %llu us)\n", "gravado_us", speed,
+         (unsigned long long) period_us);
+  size_t n_got = run(buf, len, speed, period_us, got, MAX_DECISIONS, true, NULL, NULL);
+
+  bool ok = true;
+  if (buf[4] < 2) {
+    printf("\ngravacao versao %u, sem decisoes ao vivo: so 1x contra %u%%\n", buf[4], speed);
+  } else {
+    bool same_live = same_decisions(live, n_live, "ao vivo", ref, n_ref, "1x");
+    printf("\n%zu decisoes ao vivo, %zu em 1x: %s\n", n_live, n_ref, same_live ? "iguais" : "DIFERENTES");
+    ok = same_live;
+  }
+  bool same_speed = same_decisions(ref, n_ref, "1x", got, n_got, "reproducao");
+  printf("%zu decisoes em %u%%, %zu em 1x: %s\n", n_got, speed, n_ref, same_speed ? "iguais" : "DIFERENTES");
+  return ok && same_speed ? 0 : 1;
+}
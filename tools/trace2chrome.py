@@ -0,0 +1,113 @@
+#!/usr/bin/python3
+
+# Converte o dump binário do ring buffer de rastreamento (/trace.bin)
+# para o formato JSON do Chrome Trace / Perfetto (chrome://tracing, ui.perfetto.dev).
+#
+# Uso:
+#   python3 tools/trace2chrome.py trace.bin -o trace.json
+#   python3 tools/trace2chrome.py --url http://192.168.0.50/trace.bin -o trace.json
+
+import argparse
+import json
+import struct
+import sys
+import urllib.request
+
+HEADER = struct.Struct('<4sBBHI')
+RECORD = struct.Struct('<IBBH')
+
+# Mesmos ids de trace_id_t (inc/trace.h); o "tid" separa as trilhas no
+# timeline, um por evento (cada tid recebe um único thread_name)
+EVENTS = {
+    1: ('gpio_irq', 1),
+    2: ('cgi_handler', 2),
+    3: ('oled_flush', 3),
+    4: ('ws2812_frame', 4),
+    5: ('buzzer', 5),
+    6: ('wifi', 6),
+    7: ('replay', 7),
+    8: ('input', 8),
+}
+
+WIFI_STATES = ['init', 'connecting', 'connected', 'failed']
+
+
+def parse(blob):
+    magic, version, rec_size, count, dropped = HEADER.unpack_from(blob, 0)
+    if magic != b'BBTR':
+        raise ValueError('arquivo não é um dump de rastreamento (magic {!r})'.format(magic))
+    if version != 1 or rec_size != RECORD.size:
+        raise ValueError('versão {} / registro de {} bytes não suportados'.format(version, rec_size))
+
+    records = []
+    offset = HEADER.size
+    for _ in range(count):
+        if offset + RECORD.size > len(blob):
+            break
+        records.append(RECORD.unpack_from(blob, offset))
+        offset += RECORD.size
+    return records, dropped
+
+
+def to_chrome(records):
+    events = []
+    base = None
+    last = 0
+    wraps = 0
+    for ts, ev_id, phase, arg in records:
+        # time_us_32() dá a volta a cada ~71 minutos
+        if base is not None and ts < last:
+            wraps += 1
+        last = ts
+        ts64 = ts + (wraps << 32)
+        if base is None:
+            base = ts64
+
+        name, tid = EVENTS.get(ev_id, ('event_{}'.format(ev_id), 0))
+        ev = {
+            'name': name,
+            'ph': chr(phase),
+            'ts': ts64 - base,
+            'pid': 1,
+            'tid': tid,
+            'args': {'arg': arg},
+        }
+        if name == 'wifi' and arg < len(WIFI_STATES):
+            ev['name'] = 'wifi_' + WIFI_STATES[arg]
+        if ev['ph'] == 'i':
+            ev['s'] = 't'
+        events.append(ev)
+
+    for ev_id, (name, tid) in EVENTS.items():
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid, 'args': {'name': name}})
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Converte /trace.bin para Chrome Trace JSON')
+    parser.add_argument('input', nargs='?', help='arquivo .bin baixado de /trace.bin')
+    parser.add_argument('--url', help='baixa o dump direto da placa')
+    parser.add_argument('-o', '--output', help='arquivo JSON de saída (padrão: stdout)')
+    args = parser.parse_args()
+
+    if args.url:
+        with urllib.request.urlopen(args.url, timeout=5) as resp:
+            blob = resp.read()
+    elif args.input:
+        with open(args.input, 'rb') as f:
+            blob = f.read()
+    else:
+        parser.error('informe um arquivo ou --url')
+
+    records, dropped = parse(blob)
+    trace = to_chrome(records)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    json.dump(trace, out)
+    if args.output:
+        out.close()
+    print('{} eventos convertidos ({} sobrescritos no buffer)'.format(len(records), dropped), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()